@@ -67,12 +67,30 @@ macro(CheckGNUBuiltin_CXX_bswap)
   CheckGNUBuiltin_bswap_n(CXX 64)
 endmacro()
 
+__ufw_gnu_builtin_test(
+  __UFW_GNUBuiltin_ctzl __builtin_ctzl
+  "int main(void) {
+     return __builtin_ctzl(1ul);
+   }")
+
+macro(CheckGNUBuiltin_C_ctzl)
+  check_c_source_compiles("${__UFW_GNUBuiltin_ctzl}"
+    UFW_CC_HAS_BUILTIN_CTZL)
+endmacro()
+
+macro(CheckGNUBuiltin_CXX_ctzl)
+  check_cxx_source_compiles("${__UFW_GNUBuiltin_ctzl}"
+    UFW_CXX_HAS_BUILTIN_CTZL)
+endmacro()
+
 macro(CheckAllGNUBuiltins_C)
   CheckGNUBuiltin_C_expect()
   CheckGNUBuiltin_C_bswap()
+  CheckGNUBuiltin_C_ctzl()
 endmacro()
 
 macro(CheckAllGNUBuiltins_CXX)
   CheckGNUBuiltin_CXX_expect()
   CheckGNUBuiltin_CXX_bswap()
+  CheckGNUBuiltin_CXX_ctzl()
 endmacro()
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+/**
+ * @file ex-crc16-arc-bench.c
+ * @brief Throughput benchmark for the CRC-16-ARC implementations
+ *
+ * This measures the throughput of all CRC-16-ARC implementations, that are
+ * available in the build and on the machine running the program, for buffer
+ * sizes from eight octets to one mebibyte, doubling the size in each step.
+ *
+ * Options:
+ *
+ *   -n OCTETS  Number of octets processed per measurement (default: 256MiB)
+ *   -s SIZE    Only measure a single buffer size
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <ufw/crc/crc16-arc.h>
+
+#define MIN_SIZE 8U
+#define MAX_SIZE (1024U * 1024U)
+
+static const struct {
+    CRC16ArcImpl impl;
+    const char *name;
+} impls[] = {
+    { CRC16_ARC_BYTEWISE,    "bytewise" },
+    { CRC16_ARC_SLICE_BY_8,  "slice-by-8" },
+    { CRC16_ARC_SLICE_BY_16, "slice-by-16" },
+    { CRC16_ARC_CLMUL,       "clmul" }
+};
+
+#define IMPLS (sizeof(impls) / sizeof(*impls))
+
+/* Keeps the compiler from dropping the computation. */
+static volatile uint16_t result;
+
+static double
+now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+}
+
+static void
+run(const unsigned char *data, const size_t size, const unsigned long total)
+{
+    const unsigned long iterations = (total / size) > 0UL
+        ? (total / size) : 1UL;
+
+    printf("%8zu", size);
+    for (size_t i = 0U; i < IMPLS; ++i) {
+        if (ufw_crc16_arc_select(impls[i].impl) < 0) {
+            printf("  %12s", "n/a");
+            continue;
+        }
+        uint16_t crc = CRC16_ARC_INITIAL;
+        const double start = now();
+        for (unsigned long k = 0UL; k < iterations; ++k) {
+            crc = ufw_crc16_arc(crc, data, size);
+        }
+        const double elapsed = now() - start;
+        const double mibps = ((double)iterations * (double)size)
+            / elapsed / (1024. * 1024.);
+        result = crc;
+        printf("  %7.0f MiB/s", mibps);
+    }
+    printf("\n");
+}
+
+int
+main(int argc, char *argv[])
+{
+    unsigned long total = 256UL * 1024UL * 1024UL;
+    size_t single = 0U;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+        case 'n':
+            total = strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            single = (size_t)strtoul(optarg, NULL, 0);
+            break;
+        default:
+            printf("Unknown option: %c\n", opt);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (single > MAX_SIZE || total == 0UL) {
+        printf("Size must be in 1..%u, octets must be non-zero.\n", MAX_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    unsigned char *data = malloc(MAX_SIZE);
+    if (data == NULL) {
+        printf("Could not allocate memory.\n");
+        return EXIT_FAILURE;
+    }
+
+    /* A simple linear congruential generator is plenty for this. */
+    uint32_t state = 0x12345678UL;
+    for (size_t i = 0U; i < MAX_SIZE; ++i) {
+        state = (state * 1103515245UL) + 12345UL;
+        data[i] = (unsigned char)(state >> 16);
+    }
+
+    printf("#   size");
+    for (size_t i = 0U; i < IMPLS; ++i) {
+        printf("  %12s", impls[i].name);
+    }
+    printf("\n");
+
+    if (single > 0U) {
+        run(data, single, total);
+    } else {
+        for (size_t size = MIN_SIZE; size <= MAX_SIZE; size *= 2U) {
+            run(data, size, total);
+        }
+    }
+
+    free(data);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+/**
+ * @file ex-framing-bench.c
+ * @brief Benchmark comparing SLIP and COBS framing
+ *
+ * This takes SLIP encoded frames from the files named on the command line,
+ * for example the fuzzing corpus in fuzz/ex-rfc1055-parse-frame/in, and
+ * re-encodes each frame's payload using SLIP (rfc1055_encode_buffer()) as
+ * well as COBS (cobs_encode_buffer()). For both framings, it prints the size
+ * of the frame on the wire, and the time it takes to encode and decode the
+ * frame, the latter using the resumable decoders.
+ *
+ * In addition to the frames from files, two synthetic payloads are measured:
+ * Pseudo random data, and a payload made of SLIP control characters only,
+ * which is SLIP's worst case.
+ *
+ * Options:
+ *
+ *   -n ITERATIONS  Number of times each frame is encoded and decoded
+ *                  (default: 100000)
+ *   -s SIZE        Size of the synthetic payloads in octets (default: 256)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <ufw/byte-buffer.h>
+#include <ufw/cobs.h>
+#include <ufw/compat/errno.h>
+#include <ufw/compat/ssize-t.h>
+#include <ufw/compiler.h>
+#include <ufw/endpoints.h>
+#include <ufw/rfc1055.h>
+
+#define INPUT_SIZE (64U * 1024U)
+#define MAX_FRAMES 64U
+
+typedef enum Framing {
+    FRAMING_SLIP,
+    FRAMING_COBS
+} Framing;
+
+static const char *framing_name[] = {
+    [FRAMING_SLIP] = "slip",
+    [FRAMING_COBS] = "cobs"
+};
+
+static double
+now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+}
+
+static int
+count_frame(void *arg, UNUSED ByteBuffer *frame, int status)
+{
+    size_t *frames = arg;
+    if (status == 0) {
+        (*frames)++;
+    }
+    return 0;
+}
+
+static int
+encode(const Framing f, const unsigned char *payload, const size_t n,
+       ByteBuffer *wire)
+{
+    RFC1055Context slip = RFC1055_CONTEXT_INIT_DEFAULT;
+    Sink sink;
+
+    byte_buffer_reset(wire);
+    sink_to_buffer(&sink, wire);
+    return (f == FRAMING_SLIP)
+        ? rfc1055_encode_buffer(&slip, payload, n, &sink)
+        : cobs_encode_buffer(payload, n, &sink);
+}
+
+static ssize_t
+decode(const Framing f, const ByteBuffer *wire, ByteBuffer *frame,
+       size_t *frames)
+{
+    RFC1055Context slip = RFC1055_CONTEXT_INIT_DEFAULT;
+    COBSContext cobs = COBS_CONTEXT_INIT;
+
+    return (f == FRAMING_SLIP)
+        ? rfc1055_decode_feed(&slip, wire->data, wire->used, frame,
+                              count_frame, frames)
+        : cobs_decode_feed(&cobs, wire->data, wire->used, frame,
+                           count_frame, frames);
+}
+
+static int
+run(const char *label, const unsigned char *payload, const size_t n,
+    ByteBuffer *wire, ByteBuffer *frame, const unsigned long iterations)
+{
+    printf("# %s: %zu octets of payload\n", label, n);
+    for (Framing f = FRAMING_SLIP; f <= FRAMING_COBS; ++f) {
+        double start = now();
+        for (unsigned long i = 0UL; i < iterations; ++i) {
+            const int rc = encode(f, payload, n, wire);
+            if (rc < 0) {
+                (void)fprintf(stderr, "# %s: errno: %d (%s)\n",
+                              framing_name[f], -rc, strerror(-rc));
+                return -1;
+            }
+        }
+        const double enc = (now() - start) * 1e9 / (double)iterations;
+
+        size_t frames = 0U;
+        start = now();
+        for (unsigned long i = 0UL; i < iterations; ++i) {
+            const ssize_t rc = decode(f, wire, frame, &frames);
+            if (rc < 0) {
+                (void)fprintf(stderr, "# %s: errno: %d (%s)\n",
+                              framing_name[f], (int)-rc, strerror((int)-rc));
+                return -1;
+            }
+        }
+        const double dec = (now() - start) * 1e9 / (double)iterations;
+
+        if (frames != iterations) {
+            (void)fprintf(stderr, "# %s: round trip failed\n",
+                          framing_name[f]);
+            return -1;
+        }
+        printf("%s  wire: %6zu octets  encode: %9.1f ns/frame"
+               "  decode: %9.1f ns/frame\n",
+               framing_name[f], wire->used, enc, dec);
+    }
+    return 0;
+}
+
+static int
+run_file(const char *name, ByteBuffer *wire, ByteBuffer *frame,
+         const unsigned long iterations)
+{
+    static unsigned char input[INPUT_SIZE];
+    FILE *fh = fopen(name, "rb");
+    if (fh == NULL) {
+        (void)fprintf(stderr, "# %s: %s\n", name, strerror(errno));
+        return -1;
+    }
+    const size_t n = fread(input, 1U, sizeof(input), fh);
+    (void)fclose(fh);
+
+    RFC1055Context slip = RFC1055_CONTEXT_INIT_DEFAULT;
+    RFC1055Span span[MAX_FRAMES];
+    size_t consumed;
+    const ssize_t frames = rfc1055_decode_frames(&slip, input, n, span,
+                                                 MAX_FRAMES, &consumed);
+    if (frames < 0) {
+        (void)fprintf(stderr, "# %s: errno: %d (%s)\n",
+                      name, (int)-frames, strerror((int)-frames));
+        return -1;
+    }
+
+    for (ssize_t i = 0; i < frames; ++i) {
+        /* Empty frames stem from start-of-frame delimiters. */
+        if (span[i].status < 0 || span[i].length == 0U) {
+            continue;
+        }
+        char label[256];
+        (void)snprintf(label, sizeof(label), "%s, frame %zd", name, i);
+        if (run(label, input + span[i].offset, span[i].length,
+                wire, frame, iterations) < 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    unsigned long iterations = 100000UL;
+    size_t size = 256U;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+        case 'n':
+            iterations = strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            size = (size_t)strtoul(optarg, NULL, 0);
+            break;
+        default:
+            printf("Unknown option: %c\n", opt);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (size == 0U || size > INPUT_SIZE || iterations == 0UL) {
+        printf("Size must be in 1..%u, iterations must be non-zero.\n",
+               INPUT_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    const size_t wiresize = RFC1055_WORST_CLASSIC(INPUT_SIZE);
+    unsigned char *noisy = malloc(size);
+    unsigned char *worst = malloc(size);
+    unsigned char *wiremem = malloc(wiresize);
+    unsigned char *framemem = malloc(INPUT_SIZE);
+    if (noisy == NULL || worst == NULL || wiremem == NULL || framemem == NULL)
+    {
+        printf("Could not allocate memory.\n");
+        return EXIT_FAILURE;
+    }
+
+    /* A simple linear congruential generator is plenty for this. */
+    uint32_t state = 0x12345678UL;
+    for (size_t i = 0U; i < size; ++i) {
+        state = (state * 1103515245UL) + 12345UL;
+        noisy[i] = (unsigned char)(state >> 16);
+        worst[i] = 0xc0U;
+    }
+
+    ByteBuffer wire = BYTE_BUFFER_EMPTY(wiremem, wiresize);
+    ByteBuffer frame = BYTE_BUFFER_EMPTY(framemem, INPUT_SIZE);
+    int code = EXIT_SUCCESS;
+    for (int i = optind; i < argc; ++i) {
+        if (run_file(argv[i], &wire, &frame, iterations) < 0) {
+            code = EXIT_FAILURE;
+            goto done;
+        }
+    }
+
+    if (run("pseudo random data", noisy, size, &wire, &frame,
+            iterations) < 0 ||
+        run("slip control characters only", worst, size, &wire, &frame,
+            iterations) < 0)
+    {
+        code = EXIT_FAILURE;
+    }
+
+done:
+    free(noisy);
+    free(worst);
+    free(wiremem);
+    free(framemem);
+    return code;
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+/**
+ * @file ex-register-many-bench.c
+ * @brief Benchmark for batched register access
+ *
+ * This models a control loop, that reads and writes a set of registers in
+ * every cycle. It compares calling register_get() and register_set() for each
+ * register with register_get_many() and register_set_many(). The table holds
+ * a mix of register types in a memory area, and a couple of registers in a
+ * custom area, that is backed by an array.
+ *
+ * Options:
+ *
+ *   -c CYCLES  Number of control loop cycles per measurement (default: 1e6)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <ufw/register-table.h>
+
+#define MEMORY_REGS 96U
+#define CUSTOM_REGS 16U
+#define REGS (MEMORY_REGS + CUSTOM_REGS)
+
+static RegisterAtom backing[CUSTOM_REGS * 2U];
+
+static RegisterAccess
+custom_read(const RegisterArea *a, RegisterAtom *dest,
+            RegisterOffset offset, RegisterOffset n)
+{
+    RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+    (void)a;
+    memcpy(dest, backing + offset, n * sizeof(RegisterAtom));
+    return rv;
+}
+
+static RegisterAccess
+custom_write(RegisterArea *a, const RegisterAtom *src,
+             RegisterOffset offset, RegisterOffset n)
+{
+    RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+    (void)a;
+    memcpy(backing + offset, src, n * sizeof(RegisterAtom));
+    return rv;
+}
+
+static RegisterEntry entries[REGS + 1U];
+
+static RegisterTable table = {
+    .area = (RegisterArea[]) {
+        MEMORY_AREA(0x0000ul, 0x200ul),
+        CUSTOM_AREA(custom_read, custom_write, 0x1000ul, CUSTOM_REGS * 2U),
+        REGISTER_AREA_END
+    },
+    .entry = entries,
+    .dirty = REGISTER_DIRTY_MAP(REGS)
+};
+
+static const RegisterType types[] = {
+    REG_TYPE_UINT16, REG_TYPE_UINT32, REG_TYPE_SINT16, REG_TYPE_FLOAT32
+};
+
+#define TYPES (sizeof(types) / sizeof(*types))
+
+/* Keeps the compiler from dropping the computation. */
+static volatile uint32_t result;
+
+static double
+now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+}
+
+static RegisterValue
+value_for(const RegisterType type, const uint32_t n)
+{
+    RegisterValue v = { .type = type };
+    switch (type) {
+    case REG_TYPE_UINT16:
+        v.value.u16 = (uint16_t)n;
+        break;
+    case REG_TYPE_UINT32:
+        v.value.u32 = n;
+        break;
+    case REG_TYPE_SINT16:
+        v.value.s16 = (int16_t)(n & 0x7fffU);
+        break;
+    default:
+        v.value.f32 = (float)(n + 1U);
+        break;
+    }
+    return v;
+}
+
+static void
+setup(void)
+{
+    RegisterAddress memaddr = 0x0000ul;
+    for (RegisterHandle i = 0U; i < MEMORY_REGS; ++i) {
+        const RegisterType type = types[i % TYPES];
+        entries[i] = (RegisterEntry) {
+            .type = type,
+            .address = memaddr,
+            .check.type = REGV_TYPE_TRIVIAL,
+            .default_value = value_for(type, 0U).value
+        };
+        memaddr += (type == REG_TYPE_UINT16 || type == REG_TYPE_SINT16)
+            ? 1U : 2U;
+    }
+    for (RegisterHandle i = 0U; i < CUSTOM_REGS; ++i) {
+        entries[MEMORY_REGS + i] = (RegisterEntry) {
+            .type = REG_TYPE_UINT32,
+            .address = 0x1000ul + (2U * i),
+            .check.type = REGV_TYPE_TRIVIAL,
+            .default_value.u32 = 0UL
+        };
+    }
+    entries[REGS] = (RegisterEntry)REGISTER_ENTRY_END;
+}
+
+static void
+report(const char *name, const double elapsed, const unsigned long cycles)
+{
+    printf("%-24s %8.2f ns/register\n", name,
+           elapsed * 1e9 / ((double)cycles * (double)REGS));
+}
+
+int
+main(int argc, char *argv[])
+{
+    unsigned long cycles = 1000000UL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "c:")) != -1) {
+        switch (opt) {
+        case 'c':
+            cycles = strtoul(optarg, NULL, 0);
+            break;
+        default:
+            printf("Unknown option: %c\n", opt);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (cycles == 0UL) {
+        printf("Number of cycles must be non-zero.\n");
+        return EXIT_FAILURE;
+    }
+
+    setup();
+    RegisterInit init = register_init(&table);
+    if (init.code != REG_INIT_SUCCESS) {
+        printf("Could not initialise register table: %d\n", (int)init.code);
+        return EXIT_FAILURE;
+    }
+
+    static RegisterHandle handles[REGS];
+    static RegisterValue values[REGS];
+    for (RegisterHandle i = 0U; i < REGS; ++i) {
+        handles[i] = i;
+    }
+
+    uint32_t sum = 0UL;
+    double start = now();
+    for (unsigned long k = 0UL; k < cycles; ++k) {
+        for (size_t i = 0U; i < REGS; ++i) {
+            (void)register_get(&table, handles[i], &values[i]);
+        }
+        sum += values[k % REGS].value.u16;
+    }
+    report("register_get()", now() - start, cycles);
+
+    start = now();
+    for (unsigned long k = 0UL; k < cycles; ++k) {
+        (void)register_get_many(&table, handles, REGS, values);
+        sum += values[k % REGS].value.u16;
+    }
+    report("register_get_many()", now() - start, cycles);
+
+    for (size_t i = 0U; i < REGS; ++i) {
+        values[i] = value_for(entries[i].type, (uint32_t)i);
+    }
+
+    start = now();
+    for (unsigned long k = 0UL; k < cycles; ++k) {
+        for (size_t i = 0U; i < REGS; ++i) {
+            (void)register_set(&table, handles[i], values[i]);
+        }
+    }
+    report("register_set()", now() - start, cycles);
+
+    start = now();
+    for (unsigned long k = 0UL; k < cycles; ++k) {
+        (void)register_set_many(&table, handles, REGS, values);
+    }
+    report("register_set_many()", now() - start, cycles);
+
+    result = sum + register_dirty_epoch(&table);
+    return EXIT_SUCCESS;
+}
@@ -80,7 +80,9 @@ main(UNUSED int argc, UNUSED char *argv[])
                                         sizeof(RPFrame) + offset,
                                         sizeof(RPFrame));
     RPFrame *frame = (void*)input;
-    int rc = parse_frame(&raw);
+    /* Like the receive sink in regp_recv() would have computed it. */
+    const uint16_t rawcrc = ufw_buffer_crc16_arc(start, offset);
+    int rc = parse_frame(&raw, &rawcrc);
     bool trydecode = true;
 
     printf("parse_frame: Return Value: %d\n", rc);
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+/**
+ * @file ex-rfc1055-encode-bench.c
+ * @brief Benchmark comparing the RFC1055 encoder's code paths
+ *
+ * This encodes a payload into memory many times, using the octet by octet
+ * encoder (octet source), the chunk encoder (chunk source) and the bulk
+ * encoder (rfc1055_encode_buffer()), and prints the throughput of each. A
+ * plain memcpy() of the payload is measured as a reference.
+ *
+ * Two payloads are used: One without any control characters, and one with
+ * pseudo random data, where about one in 128 octets needs escaping.
+ *
+ * Options:
+ *
+ *   -n ITERATIONS  Number of times each payload is encoded (default: 2000)
+ *   -s SIZE        Size of the payloads in octets (default: 16384)
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <ufw/byte-buffer.h>
+#include <ufw/compat/errno.h>
+#include <ufw/compat/ssize-t.h>
+#include <ufw/compiler.h>
+#include <ufw/endpoints.h>
+#include <ufw/rfc1055.h>
+
+typedef enum EncodePath {
+    PATH_MEMCPY,
+    PATH_OCTET,
+    PATH_CHUNK,
+    PATH_BUFFER
+} EncodePath;
+
+static const char *path_name[] = {
+    [PATH_MEMCPY] = "memcpy (reference)",
+    [PATH_OCTET]  = "rfc1055_encode, octet source",
+    [PATH_CHUNK]  = "rfc1055_encode, chunk source",
+    [PATH_BUFFER] = "rfc1055_encode_buffer"
+};
+
+static int
+read_octet(void *driver, void *data)
+{
+    ByteBuffer *b = driver;
+    const ssize_t rc = byte_buffer_consume_at_most(b, data, 1U);
+    return (rc < 0) ? (int)rc : 1;
+}
+
+static double
+now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + ((double)ts.tv_nsec / 1e9);
+}
+
+static int
+encode_once(const EncodePath path, unsigned char *payload, const size_t n,
+            ByteBuffer *out)
+{
+    RFC1055Context ctx = RFC1055_CONTEXT_INIT_DEFAULT;
+    ByteBuffer in = BYTE_BUFFER(payload, n);
+    Source source;
+    Sink sink;
+
+    byte_buffer_reset(out);
+    sink_to_buffer(&sink, out);
+
+    switch (path) {
+    case PATH_MEMCPY:
+        memcpy(out->data, payload, n);
+        out->used = n;
+        return 0;
+    case PATH_OCTET:
+        octet_source_init(&source, read_octet, &in);
+        return rfc1055_encode(&ctx, &source, &sink);
+    case PATH_CHUNK:
+        source_from_buffer(&source, &in);
+        return rfc1055_encode(&ctx, &source, &sink);
+    case PATH_BUFFER:
+    default:
+        return rfc1055_encode_buffer(&ctx, payload, n, &sink);
+    }
+}
+
+static int
+run(const char *label, unsigned char *payload, const size_t n,
+    ByteBuffer *out, const unsigned long iterations)
+{
+    printf("# payload: %s, %zu octets, %lu iterations\n",
+           label, n, iterations);
+    for (EncodePath p = PATH_MEMCPY; p <= PATH_BUFFER; ++p) {
+        const double start = now();
+        for (unsigned long i = 0UL; i < iterations; ++i) {
+            const int rc = encode_once(p, payload, n, out);
+            if (rc < 0) {
+                (void)fprintf(stderr, "# %s: errno: %d (%s)\n",
+                              path_name[p], -rc, strerror(-rc));
+                return -1;
+            }
+        }
+        const double elapsed = now() - start;
+        const double mib = ((double)n * (double)iterations)
+            / (1024. * 1024.);
+        printf("%-32s %10.1f MiB/s  (%zu octets out)\n",
+               path_name[p], mib / elapsed, out->used);
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    unsigned long iterations = 2000UL;
+    size_t size = 16384U;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+        case 'n':
+            iterations = strtoul(optarg, NULL, 0);
+            break;
+        case 's':
+            size = (size_t)strtoul(optarg, NULL, 0);
+            break;
+        default:
+            printf("Unknown option: %c\n", opt);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (size == 0U || iterations == 0UL) {
+        printf("Size and iterations must be non-zero.\n");
+        return EXIT_FAILURE;
+    }
+
+    const size_t outsize = RFC1055_WORST_CLASSIC(size);
+    unsigned char *clean = malloc(size);
+    unsigned char *noisy = malloc(size);
+    unsigned char *outmem = malloc(outsize);
+    if (clean == NULL || noisy == NULL || outmem == NULL) {
+        printf("Could not allocate memory.\n");
+        return EXIT_FAILURE;
+    }
+
+    /* A simple linear congruential generator is plenty for this. */
+    uint32_t state = 0x12345678UL;
+    for (size_t i = 0U; i < size; ++i) {
+        state = (state * 1103515245UL) + 12345UL;
+        const unsigned char octet = (unsigned char)(state >> 16);
+        noisy[i] = octet;
+        clean[i] = (octet == 0xc0U || octet == 0xdbU) ? 0x55U : octet;
+    }
+
+    ByteBuffer out = BYTE_BUFFER_EMPTY(outmem, outsize);
+    int code = EXIT_SUCCESS;
+    if (run("no control characters", clean, size, &out, iterations) < 0 ||
+        run("pseudo random data", noisy, size, &out, iterations) < 0)
+    {
+        code = EXIT_FAILURE;
+    }
+
+    free(clean);
+    free(noisy);
+    free(outmem);
+    return code;
+}
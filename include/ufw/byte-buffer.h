@@ -113,6 +113,11 @@ void byte_buffer_fill_cb(ByteBuffer *b, size_t offset,
 size_t byte_buffer_avail(const ByteBuffer *b);
 size_t byte_buffer_rest(const ByteBuffer *b);
 
+size_t byte_chunks_avail(const ByteChunks *c);
+size_t byte_chunks_rest(const ByteChunks *c);
+size_t byte_chunks_markread(ByteChunks *c, size_t size);
+size_t byte_chunks_markwritten(ByteChunks *c, size_t size);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#ifndef INC_UFW_COBS_H
+#define INC_UFW_COBS_H
+
+/**
+ * @addtogroup protocobs Consistent Overhead Byte Stuffing (COBS)
+ *
+ * Implementation of the COBS framing protocol
+ *
+ * COBS removes all zero octets from a payload, so that a zero octet can be
+ * used to delimit frames. Payload is split into blocks at its zero octets.
+ * Each block is prefixed by a code octet, that holds the length of the block
+ * plus one; the zero that ended the block is implied. Blocks without a zero
+ * are limited to 254 octets, and use the code octet 0xff.
+ *
+ * In contrast to SLIP, where each control character in the payload costs an
+ * extra octet, the overhead of COBS does not depend on the payload: It is at
+ * most one octet per 254 octets of payload, plus one octet for the code of
+ * the first block and one octet for the frame delimiter.
+ *
+ * See Cheshire, Baker: "Consistent Overhead Byte Stuffing", IEEE/ACM
+ * Transactions on Networking, Vol. 7, No. 2, April 1999 for details.
+ *
+ * @{
+ *
+ * @file ufw/cobs.h
+ * @brief Consistent Overhead Byte Stuffing
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ufw/byte-buffer.h>
+#include <ufw/compat/ssize-t.h>
+#include <ufw/endpoints.h>
+
+/* Maximum number of payload octets in one block */
+#define COBS_BLOCK_SIZE 254u
+
+/* Maximum size of an encoded frame for n octets of payload, delimiter
+ * included. */
+#define COBS_WORST_CASE(n) ((n) + ((n) / COBS_BLOCK_SIZE) + 2u)
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct cobs_context {
+    enum {
+        /* Expecting the first code octet of a frame. Delimiters in this state
+         * are skipped, so they can be used as start-of-frame markers. */
+        COBS_START,
+        /* Expecting a code octet or the delimiter that ends the frame. */
+        COBS_CODE,
+        /* Inside of a block, with "remaining" octets left. */
+        COBS_DATA,
+        /* Dropping data up to the next delimiter. */
+        COBS_SEARCH_FOR_END
+    } state;
+    /* Number of payload octets left in the current block */
+    uint8_t remaining;
+    /* Whether the current block ends in an implied zero octet */
+    bool zero;
+} COBSContext;
+
+#define COBS_CONTEXT_INIT                       \
+    { .state = COBS_START,                      \
+      .remaining = 0u,                          \
+      .zero = false }
+
+/**
+ * Function type used by cobs_decode_feed() to deliver frames
+ *
+ * This works like RFC1055FrameCallback: Arguments are the user supplied
+ * argument, the buffer holding the decoded frame and a status code: Zero for
+ * complete frames, -EILSEQ for frames that ended in the middle of a block,
+ * and -ENOBUFS for frames that did not fit into the frame buffer. The frame
+ * buffer is reset after the callback returns. Negative return values stop the
+ * decoder and are returned by cobs_decode_feed().
+ */
+typedef int (*COBSFrameCallback)(void*, ByteBuffer*, int);
+
+void cobs_context_init(COBSContext *ctx);
+int cobs_encode(Source *source, Sink *sink);
+int cobs_encode_buffer(const void *data, size_t n, Sink *sink);
+int cobs_decode(COBSContext *ctx, Source *source, Sink *sink);
+ssize_t cobs_decode_feed(COBSContext *ctx, const void *in, size_t n,
+                         ByteBuffer *frame, COBSFrameCallback cb, void *arg);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* INC_UFW_COBS_H */
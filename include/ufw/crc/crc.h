@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#ifndef INC_UFW_CRC_CRC_H_2b3fd8a1
+#define INC_UFW_CRC_CRC_H_2b3fd8a1
+
+/**
+ * @addtogroup checksums Checksum Algorithms
+ * @{
+ *
+ * @file ufw/crc/crc.h
+ * @brief Generic CRC engine
+ *
+ * This implements table driven CRCs of eight, sixteen and thirty-two bits for
+ * arbitrary polynomials, parameterised like in the Rocksoft model (width,
+ * polynomial, initial value, input and output reflection, final XOR value).
+ * Like with ring buffers, a header uses CRC_API() to declare the functions of
+ * a CRC, and a compilation unit uses CRC_DEFINE() to implement them:
+ *
+ * @code
+ *     CRC_API(ufw_crc32, 32)
+ *     CRC_DEFINE(ufw_crc32, 32, 0x04c11db7UL, 0xffffffffUL,
+ *                true, true, 0xffffffffUL)
+ * @endcode
+ *
+ * CRC_DEFINE() expects two constant tables next to it: NAME_table, with one
+ * to sixteen tables of 256 entries, and NAME_fold, with four folding
+ * constants. ‘tools/make-crc-table.scm’ is meant to generate both, but it has
+ * not been run yet: The tables in the tree come from an independent model of
+ * its algorithm. The number of tables determines how many octets are
+ * processed per step (slice-by-N); the additional tables are guarded by
+ * UFW_CRC_SLICES, so the build configuration decides how much memory is spent
+ * on them. For bit-reflected CRCs, large inputs are folded using carry-less
+ * multiplication, if the machine supports it (see ufw_crc_fold()).
+ *
+ * For a CRC called NAME, this defines the following functions. All CRC
+ * values they take and return are final CRC values, including reflection and
+ * final XOR. To compute a CRC in pieces, start with the CRC of no data at all,
+ * and pass the result of each call to the next.
+ *
+ *   - NAME(crc, buffer, n): Update crc with n octets from buffer.
+ *   - NAME_buffer(buffer, n): CRC of n octets from buffer.
+ *   - NAME_zeros(delta, n): Extends the difference of two CRCs of data of
+ *     equal length by n zero octets. For CRCs without initial value and final
+ *     XOR, this is the CRC extended by n zero octets.
+ *   - NAME_combine(crca, crcb, lenb): CRC of two consecutive blocks.
+ *   - NAME_replace(crc, len, offset, prev, next, n): CRC of a buffer after
+ *     changing part of it.
+ *   - NAME_memcpy(crc, dst, src, n): Copy n octets from src to dst, and
+ *     update crc with them. See below.
+ *   - NAME_persistent(data, n, crc): NAME() with the argument order of the
+ *     persistent storage checksum callbacks.
+ *
+ * NAME_memcpy() is meant for places that copy data they have to checksum
+ * anyway, so the data is only fetched from memory once: It copies in blocks
+ * of UFW_CRC_COPY_CHUNK octets and processes each block from the destination
+ * while it is still in the cache. The areas must not overlap, unless ‘dst’
+ * equals ‘src’, in which case nothing is copied.
+ *
+ * CRC_DEFINE_WITH() takes an additional argument: The name of a function that
+ * processes input, with the signature of NAME_process(), which is the table
+ * driven implementation (including folding) generated by CRC_DEFINE(). This
+ * allows for implementations that use dedicated CRC instructions, which can
+ * fall back to NAME_octets() or NAME_process() for input they cannot handle:
+ *
+ * @code
+ *     static uint32_t crc32c_hw(uint32_t reg, const unsigned char *src,
+ *                               size_t n);
+ *     CRC_DEFINE_WITH(ufw_crc32c, 32, 0x1edc6f41UL, 0xffffffffUL,
+ *                     true, true, 0xffffffffUL, crc32c_hw)
+ * @endcode
+ *
+ * The register value passed to that function, and returned by it, is in the
+ * orientation of the algorithm, without initial value and final XOR applied.
+ *
+ * NAME matches vp_chksum_fnc for sixteen bit CRCs, NAME_persistent matches
+ * PersistentChksum16 and PersistentChksum32, and NAME_zeros matches the
+ * incremental update callbacks of both modules.
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Octets processed per step by the table driven implementations. */
+#ifndef UFW_CRC_SLICES
+#define UFW_CRC_SLICES 1
+#endif /* UFW_CRC_SLICES */
+
+#if (UFW_CRC_SLICES != 1) && (UFW_CRC_SLICES != 8) && (UFW_CRC_SLICES != 16)
+#error "UFW_CRC_SLICES must be one of 1, 8 or 16"
+#endif /* UFW_CRC_SLICES check */
+
+/** Minimum number of octets processed by ufw_crc_fold() */
+#define UFW_CRC_FOLD_MIN 64U
+
+/** Block size of the copying CRC functions; small enough to stay in L1 */
+#ifndef UFW_CRC_COPY_CHUNK
+#define UFW_CRC_COPY_CHUNK 1024U
+#endif /* UFW_CRC_COPY_CHUNK */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+uint64_t ufw_crc_reflect(uint64_t value, unsigned int width);
+uint64_t ufw_crc_zeros(uint64_t reg, size_t n, unsigned int width,
+                       uint64_t poly, bool reflected);
+bool ufw_crc_fold_available(void);
+size_t ufw_crc_fold(const uint64_t *k, uint64_t reg,
+                    const void *buffer, size_t n, unsigned char *acc);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+/* NOLINTBEGIN(bugprone-macro-parentheses) */
+
+#define CRC_TYPE__(WIDTH) uint##WIDTH##_t
+
+#define CRC_API(NAME,WIDTH)                                             \
+    CRC_TYPE__(WIDTH) NAME(CRC_TYPE__(WIDTH), const void*, size_t);     \
+    CRC_TYPE__(WIDTH) NAME##_buffer(const void*, size_t);               \
+    CRC_TYPE__(WIDTH) NAME##_zeros(CRC_TYPE__(WIDTH), size_t);          \
+    CRC_TYPE__(WIDTH) NAME##_combine(CRC_TYPE__(WIDTH),                 \
+                                     CRC_TYPE__(WIDTH), size_t);        \
+    CRC_TYPE__(WIDTH) NAME##_replace(CRC_TYPE__(WIDTH), size_t, size_t, \
+                                     const void*, const void*, size_t); \
+    CRC_TYPE__(WIDTH) NAME##_memcpy(CRC_TYPE__(WIDTH), void*,           \
+                                    const void*, size_t);               \
+    CRC_TYPE__(WIDTH) NAME##_persistent(const unsigned char*, size_t,   \
+                                        CRC_TYPE__(WIDTH));
+
+#define CRC_DEFINE(NAME,WIDTH,POLY,INIT,REFIN,REFOUT,XOROUT)            \
+    CRC_DEFINE_WITH(NAME,WIDTH,POLY,INIT,REFIN,REFOUT,XOROUT,NAME##_process)
+
+#define CRC_DEFINE_WITH(NAME,WIDTH,POLY,INIT,REFIN,REFOUT,XOROUT,PROCESS) \
+    CRC_REGISTER__(NAME,WIDTH,INIT,REFIN,REFOUT,XOROUT)                   \
+    CRC_OCTETS__(NAME,WIDTH,REFIN)                                        \
+    CRC_PROCESS__(NAME,WIDTH,REFIN)                                       \
+    CRC_UPDATE__(NAME,WIDTH,PROCESS)                                      \
+    CRC_ZEROS__(NAME,WIDTH,POLY,REFIN,REFOUT)                             \
+    CRC_COMBINE__(NAME,WIDTH,POLY,REFIN)                                  \
+    CRC_REPLACE__(NAME,WIDTH)                                             \
+    CRC_MEMCPY__(NAME,WIDTH,PROCESS)
+
+/*
+ * The functions in this module keep the CRC register in the orientation of
+ * the algorithm: Reflected for reflected input, and not reflected otherwise.
+ * These convert between register values and final CRC values.
+ */
+#define CRC_REGISTER__(NAME,WIDTH,INIT,REFIN,REFOUT,XOROUT)             \
+    static inline CRC_TYPE__(WIDTH)                                     \
+    NAME##_start(void)                                                  \
+    {                                                                   \
+        return (REFIN)                                                  \
+            ? (CRC_TYPE__(WIDTH))ufw_crc_reflect((INIT), (WIDTH))       \
+            : (CRC_TYPE__(WIDTH))(INIT);                                \
+    }                                                                   \
+                                                                        \
+    static inline CRC_TYPE__(WIDTH)                                     \
+    NAME##_orient(CRC_TYPE__(WIDTH) value)                              \
+    {                                                                   \
+        return ((REFIN) != (REFOUT))                                    \
+            ? (CRC_TYPE__(WIDTH))ufw_crc_reflect(value, (WIDTH))        \
+            : value;                                                    \
+    }                                                                   \
+                                                                        \
+    static inline CRC_TYPE__(WIDTH)                                     \
+    NAME##_finish(CRC_TYPE__(WIDTH) reg)                                \
+    {                                                                   \
+        return (CRC_TYPE__(WIDTH))(NAME##_orient(reg) ^ (XOROUT));      \
+    }                                                                   \
+                                                                        \
+    static inline CRC_TYPE__(WIDTH)                                     \
+    NAME##_resume(CRC_TYPE__(WIDTH) crc)                                \
+    {                                                                   \
+        return NAME##_orient((CRC_TYPE__(WIDTH))(crc ^ (XOROUT)));      \
+    }
+
+/*
+ * Slice-by-N processes N octets per step, where table k holds the CRC of an
+ * octet followed by k zero octets. The register has to be shifted out
+ * entirely by one step, so this is only used if N * 8 >= WIDTH.
+ */
+#define CRC_OCTETS__(NAME,WIDTH,REFIN)                                  \
+    static CRC_TYPE__(WIDTH)                                            \
+    NAME##_octets(CRC_TYPE__(WIDTH) reg, const unsigned char *src,      \
+                  size_t n)                                             \
+    {                                                                   \
+        const size_t slices = sizeof(NAME##_table)                      \
+            / sizeof(NAME##_table[0]);                                  \
+        if (slices > 1U && (slices * 8U) >= (WIDTH)) {                  \
+            while (n >= slices) {                                       \
+                CRC_TYPE__(WIDTH) next = 0U;                            \
+                for (size_t k = 0U; k < slices; ++k) {                  \
+                    unsigned int octet = src[k];                        \
+                    if ((k * 8U) < (WIDTH)) {                           \
+                        octet ^= (unsigned int)((REFIN)                 \
+                            ? (reg >> (k * 8U))                         \
+                            : (reg >> ((WIDTH) - 8U - (k * 8U))));      \
+                    }                                                   \
+                    next ^= NAME##_table[slices - 1U - k][octet & 0xffU]; \
+                }                                                       \
+                reg = next;                                             \
+                src += slices;                                          \
+                n -= slices;                                            \
+            }                                                           \
+        }                                                               \
+        for (size_t i = 0U; i < n; ++i) {                               \
+            if (REFIN) {                                                \
+                reg = (CRC_TYPE__(WIDTH))((reg >> 8U)                   \
+                    ^ NAME##_table[0][(reg ^ src[i]) & 0xffU]);         \
+            } else {                                                    \
+                reg = (CRC_TYPE__(WIDTH))((reg << 8U)                   \
+                    ^ NAME##_table[0][((reg >> ((WIDTH) - 8U)) ^ src[i]) \
+                                      & 0xffU]);                        \
+            }                                                           \
+        }                                                               \
+        return reg;                                                     \
+    }
+
+/*
+ * Reflected CRCs fold large inputs into a 128 bit accumulator, the CRC of
+ * which is then computed using the tables. See ufw_crc_fold().
+ */
+#define CRC_PROCESS__(NAME,WIDTH,REFIN)                                 \
+    static CRC_TYPE__(WIDTH)                                            \
+    NAME##_process(CRC_TYPE__(WIDTH) reg, const unsigned char *src,     \
+                   size_t n)                                            \
+    {                                                                   \
+        if ((REFIN) && n >= UFW_CRC_FOLD_MIN) {                         \
+            unsigned char acc[16];                                      \
+            const size_t used = ufw_crc_fold(NAME##_fold, reg,          \
+                                             src, n, acc);              \
+            if (used > 0U) {                                            \
+                reg = NAME##_octets(0U, acc, sizeof(acc));              \
+                src += used;                                            \
+                n -= used;                                              \
+            }                                                           \
+        }                                                               \
+        return NAME##_octets(reg, src, n);                              \
+    }
+
+#define CRC_UPDATE__(NAME,WIDTH,PROCESS)                                \
+    CRC_TYPE__(WIDTH)                                                   \
+    NAME(CRC_TYPE__(WIDTH) crc, const void *buffer, size_t n)           \
+    {                                                                   \
+        return NAME##_finish(PROCESS(NAME##_resume(crc), buffer, n));   \
+    }                                                                   \
+                                                                        \
+    CRC_TYPE__(WIDTH)                                                   \
+    NAME##_buffer(const void *buffer, size_t n)                         \
+    {                                                                   \
+        return NAME##_finish(PROCESS(NAME##_start(), buffer, n));       \
+    }                                                                   \
+                                                                        \
+    CRC_TYPE__(WIDTH)                                                   \
+    NAME##_persistent(const unsigned char *data, size_t n,              \
+                      CRC_TYPE__(WIDTH) crc)                            \
+    {                                                                   \
+        return NAME(crc, data, n);                                      \
+    }
+
+/* Differences of final CRC values are differences of registers, oriented
+ * like the final value; the final XOR cancels out. */
+#define CRC_ZEROS__(NAME,WIDTH,POLY,REFIN,REFOUT)                       \
+    CRC_TYPE__(WIDTH)                                                   \
+    NAME##_zeros(CRC_TYPE__(WIDTH) delta, size_t n)                     \
+    {                                                                   \
+        const CRC_TYPE__(WIDTH) reg = NAME##_orient(delta);             \
+        return NAME##_orient((CRC_TYPE__(WIDTH))ufw_crc_zeros(          \
+                                 reg, n, (WIDTH), (POLY), (REFIN)));    \
+    }
+
+/* Processing B starting at register r is the same as extending r by the
+ * length of B, XOR processing B starting at zero. Both CRCs started at the
+ * initial register value, hence that value cancels out. */
+#define CRC_COMBINE__(NAME,WIDTH,POLY,REFIN)                            \
+    CRC_TYPE__(WIDTH)                                                   \
+    NAME##_combine(CRC_TYPE__(WIDTH) crca, CRC_TYPE__(WIDTH) crcb,      \
+                   size_t lenb)                                         \
+    {                                                                   \
+        const CRC_TYPE__(WIDTH) reg = (CRC_TYPE__(WIDTH))               \
+            (NAME##_resume(crca) ^ NAME##_start());                     \
+        return NAME##_finish((CRC_TYPE__(WIDTH))                        \
+            (ufw_crc_zeros(reg, lenb, (WIDTH), (POLY), (REFIN))         \
+             ^ NAME##_resume(crcb)));                                   \
+    }
+
+#define CRC_REPLACE__(NAME,WIDTH)                                       \
+    CRC_TYPE__(WIDTH)                                                   \
+    NAME##_replace(CRC_TYPE__(WIDTH) crc, size_t len, size_t offset,    \
+                   const void *prev, const void *next, size_t n)        \
+    {                                                                   \
+        const CRC_TYPE__(WIDTH) delta = (CRC_TYPE__(WIDTH))             \
+            (NAME(0U, prev, n) ^ NAME(0U, next, n));                    \
+        return (CRC_TYPE__(WIDTH))                                      \
+            (crc ^ NAME##_zeros(delta, len - offset - n));              \
+    }
+
+#define CRC_MEMCPY__(NAME,WIDTH,PROCESS)                                \
+    CRC_TYPE__(WIDTH)                                                   \
+    NAME##_memcpy(CRC_TYPE__(WIDTH) crc, void *dst, const void *src,    \
+                  size_t n)                                             \
+    {                                                                   \
+        unsigned char *to = dst;                                        \
+        const unsigned char *from = src;                                \
+        CRC_TYPE__(WIDTH) reg = NAME##_resume(crc);                     \
+        while (n > 0U) {                                                \
+            const size_t k = (n > UFW_CRC_COPY_CHUNK)                   \
+                ? UFW_CRC_COPY_CHUNK : n;                               \
+            if (to != from) {                                           \
+                memcpy(to, from, k);                                    \
+            }                                                           \
+            reg = PROCESS(reg, to, k);                                  \
+            to += k;                                                    \
+            from += k;                                                  \
+            n -= k;                                                     \
+        }                                                               \
+        return NAME##_finish(reg);                                      \
+    }
+
+/* NOLINTEND(bugprone-macro-parentheses) */
+
+#endif /* INC_UFW_CRC_CRC_H_2b3fd8a1 */
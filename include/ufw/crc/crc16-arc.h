@@ -20,21 +20,52 @@
  * @}
  */
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #define CRC16_ARC_INITIAL 0x0000u
 
+/**
+ * Implementations of CRC-16-ARC
+ *
+ * The byte-wise implementation is always available. Slice-by-8 and
+ * slice-by-16 need 3.5KiB and 7.5KiB of additional tables, and are only
+ * built if UFW_CRC_SLICES is configured to at least 8 or 16
+ * respectively. The carry-less-multiply implementation uses PCLMULQDQ on
+ * x86_64 and PMULL on AArch64, and is only available if the CPU running the
+ * code supports these instructions.
+ */
+typedef enum CRC16ArcImpl {
+    CRC16_ARC_AUTO = 0,
+    CRC16_ARC_BYTEWISE,
+    CRC16_ARC_SLICE_BY_8,
+    CRC16_ARC_SLICE_BY_16,
+    CRC16_ARC_CLMUL
+} CRC16ArcImpl;
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
 
+void ufw_crc16_arc_init(void);
+bool ufw_crc16_arc_available(CRC16ArcImpl impl);
+int ufw_crc16_arc_select(CRC16ArcImpl impl);
+CRC16ArcImpl ufw_crc16_arc_active(void);
+
 uint16_t ufw_crc16_arc(uint16_t crc, const void *buffer, size_t n);
 uint16_t ufw_buffer_crc16_arc(const void *buffer, size_t len);
 
 uint16_t ufw_crc16_arc_u16(uint16_t crc, const uint16_t *buffer, size_t len);
 uint16_t ufw_buffer_crc16_arc_u16(const uint16_t *buffer, size_t len);
 
+uint16_t ufw_crc16_arc_zeros(uint16_t crc, size_t n);
+uint16_t ufw_crc16_arc_combine(uint16_t crca, uint16_t crcb, size_t lenb);
+uint16_t ufw_crc16_arc_replace(uint16_t crc, size_t len, size_t offset,
+                               const void *prev, const void *next, size_t n);
+uint16_t ufw_crc16_arc_memcpy(uint16_t crc, void *dst, const void *src,
+                              size_t n);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#ifndef INC_UFW_CRC_CRC16_CCITT_H_5a0e97b2
+#define INC_UFW_CRC_CRC16_CCITT_H_5a0e97b2
+
+/**
+ * @addtogroup checksums Checksum Algorithms
+ * @{
+ *
+ * @file ufw/crc/crc16-ccitt.h
+ * @brief CRC-16/CCITT-FALSE API
+ *
+ * The sixteen bit CRC most commonly referred to as CRC-16-CCITT (also known
+ * as CRC-16/CCITT-FALSE and CRC-16/IBM-3740): Polynomial 0x1021, not
+ * reflected, initial value 0xffff, no final XOR. The check value for
+ * "123456789" is 0x29b1. See ufw/crc/crc.h for the API.
+ *
+ * @}
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ufw/crc/crc.h>
+
+/** CRC-16/CCITT-FALSE of no data; the value to start computations with */
+#define CRC16_CCITT_INITIAL 0xffffU
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+CRC_API(ufw_crc16_ccitt, 16)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* INC_UFW_CRC_CRC16_CCITT_H_5a0e97b2 */
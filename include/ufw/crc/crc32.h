@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#ifndef INC_UFW_CRC_CRC32_H_8e61c0d4
+#define INC_UFW_CRC_CRC32_H_8e61c0d4
+
+/**
+ * @addtogroup checksums Checksum Algorithms
+ * @{
+ *
+ * @file ufw/crc/crc32.h
+ * @brief CRC-32 API
+ *
+ * CRC-32 as used by Ethernet, zlib and many others (also known as
+ * CRC-32/ISO-HDLC): Polynomial 0x04c11db7, reflected, initial value and final
+ * XOR 0xffffffff. The check value for "123456789" is 0xcbf43926. See
+ * ufw/crc/crc.h for the API.
+ *
+ * @}
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ufw/crc/crc.h>
+
+/** CRC-32 of no data; the value to start computations in pieces with */
+#define CRC32_INITIAL 0x00000000UL
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+CRC_API(ufw_crc32, 32)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* INC_UFW_CRC_CRC32_H_8e61c0d4 */
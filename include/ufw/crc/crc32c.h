@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#ifndef INC_UFW_CRC_CRC32C_H_d17f4a30
+#define INC_UFW_CRC_CRC32C_H_d17f4a30
+
+/**
+ * @addtogroup checksums Checksum Algorithms
+ * @{
+ *
+ * @file ufw/crc/crc32c.h
+ * @brief CRC-32C API
+ *
+ * CRC-32C (Castagnoli, also known as CRC-32/ISCSI), as used by iSCSI, SCTP,
+ * ext4 and others: Polynomial 0x1edc6f41, reflected, initial value and final
+ * XOR 0xffffffff. The check value for "123456789" is 0xe3069283. See
+ * ufw/crc/crc.h for the API.
+ *
+ * On x86_64 and AArch64, this uses the CRC-32C instructions of the CPU if
+ * available, which makes it the fastest CRC in the library on these machines.
+ * That makes it a good choice for the checksum of large persistent storage
+ * instances:
+ *
+ * @code
+ *     persistent_sum32(&store, ufw_crc32c_persistent, CRC32C_INITIAL);
+ *     persistent_sum32_zeros(&store, ufw_crc32c_zeros);
+ * @endcode
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ufw/crc/crc.h>
+
+/** CRC-32C of no data; the value to start computations in pieces with */
+#define CRC32C_INITIAL 0x00000000UL
+
+/**
+ * Implementations of CRC-32C
+ *
+ * The table driven implementation is always available; it processes eight
+ * octets per step if UFW_CRC_SLICES is configured to at least 8. Folding
+ * uses carry-less multiplication for large inputs (see ufw_crc_fold()). The
+ * hardware implementation uses the crc32 instruction of SSE4.2 on x86_64 and
+ * the CRC32C instructions of ARMv8 on AArch64, processing three streams of
+ * data in parallel for large inputs. It is only available if the CPU running
+ * the code supports these instructions.
+ */
+typedef enum CRC32CImpl {
+    CRC32C_AUTO = 0,
+    CRC32C_TABLE,
+    CRC32C_FOLD,
+    CRC32C_HARDWARE
+} CRC32CImpl;
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+void ufw_crc32c_init(void);
+bool ufw_crc32c_available(CRC32CImpl impl);
+int ufw_crc32c_select(CRC32CImpl impl);
+CRC32CImpl ufw_crc32c_active(void);
+
+CRC_API(ufw_crc32c, 32)
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* INC_UFW_CRC_CRC32C_H_d17f4a30 */
@@ -20,6 +20,12 @@
  * sources/sinks. The underlying driver can be either of those access paradigms
  * and the abstraction implements the other on top of it.
  *
+ * A third access paradigm transfers vectors of buffers (ByteChunks) in one
+ * go, similar to POSIX readv() and writev(). Endpoints of kind
+ * DATA_KIND_VECTOR implement it natively; for all other endpoints it is
+ * implemented on top of their respective paradigm. Vector endpoints in turn
+ * can be used with all other APIs.
+ *
  * Functions implementing endpoints must return the number of octet transmitted
  * (i.e. read or written). In case of an error, the functions must return
  * `-ERRNO`. Additionally, when sources run out of data permanently, they need
@@ -122,14 +128,56 @@ typedef ssize_t (*ChunkSink)(void*, const void*, size_t);
 /** Function type that produces a buffer of octets */
 typedef ssize_t (*ChunkSource)(void*, void*, size_t);
 
+/**
+ * Function type that accepts a vector of buffers of octets
+ *
+ * The unprocessed data of all chunks, starting with the active one, is to be
+ * written. The function must not modify the chunks. It returns the number of
+ * octets it accepted, which may be less than the amount that was offered.
+ */
+typedef ssize_t (*ChunksSink)(void*, const ByteChunks*);
+
+/**
+ * Function type that produces into a vector of buffers of octets
+ *
+ * The free space of all chunks, starting with the active one, is to be filled.
+ * The function must not modify the chunks' meta data. It returns the number
+ * of octets it produced, which may be less than the space that was offered.
+ */
+typedef ssize_t (*ChunksSource)(void*, const ByteChunks*);
+
 typedef enum ufw_data_kind {
     DATA_KIND_OCTET,
-    DATA_KIND_CHUNK
+    DATA_KIND_CHUNK,
+    DATA_KIND_VECTOR
 } DataKind;
 
 typedef ByteBuffer (*SinkGetBuffer)(Sink*);
 typedef ByteBuffer (*SourceGetBuffer)(Source*);
 
+/**
+ * Reasons for a sink to flush data it holds back
+ *
+ * EP_FLUSH_REQUEST is an explicit request by the user, that sinks must honour.
+ * EP_FLUSH_END_OF_FRAME is a hint from a framing protocol, that a complete
+ * frame was just handed to the sink. Sinks may choose to ignore the latter.
+ */
+typedef enum ufw_ep_flush_reason {
+    EP_FLUSH_REQUEST,
+    EP_FLUSH_END_OF_FRAME
+} EndpointFlushReason;
+
+typedef int (*SinkFlush)(void*, EndpointFlushReason);
+
+/**
+ * Function type to reserve memory inside of a sink's own storage
+ *
+ * Arguments are the sink's driver, a pointer to return the reserved memory
+ * through, and the minimum and maximum amount of memory to reserve. Returns
+ * the amount of memory reserved, or -ENOMEM if the minimum cannot be met.
+ */
+typedef ssize_t (*SinkReserve)(void*, void**, size_t, size_t);
+
 struct ufw_ep_retry;
 typedef void (*EndpointRetryInit)(struct ufw_ep_retry*);
 typedef ssize_t (*EndpointRetry)(void*, void*, ssize_t);
@@ -154,6 +202,7 @@ struct ufw_source {
     union {
         ByteSource octet;
         ChunkSource chunk;
+        ChunksSource vector;
     } source;
     struct ufw_ep_retry retry;
     struct {
@@ -168,11 +217,14 @@ struct ufw_sink {
     union {
         ByteSink octet;
         ChunkSink chunk;
+        ChunksSink vector;
     } sink;
     struct ufw_ep_retry retry;
     struct {
         SinkGetBuffer getbuffer;
         EndpointSeek seek;
+        SinkFlush flush;
+        SinkReserve reserve;
     } ext;
 };
 
@@ -192,13 +244,23 @@ struct ufw_sink {
         .ext.getbuffer = NULL,          \
         .ext.seek = NULL }
 
+#define VECTOR_SOURCE_INIT(CB, DRIVER) { \
+        .kind = DATA_KIND_VECTOR,        \
+        .driver = (DRIVER),              \
+        .source.vector = (CB),           \
+        .retry = EP_RETRY_INIT,          \
+        .ext.getbuffer = NULL,           \
+        .ext.seek = NULL }
+
 #define OCTET_SINK_INIT(CB, DRIVER) {   \
         .kind = DATA_KIND_OCTET,        \
         .driver = (DRIVER),             \
         .sink.octet = (CB),             \
         .retry = EP_RETRY_INIT,         \
         .ext.getbuffer = NULL,          \
-        .ext.seek = NULL }
+        .ext.seek = NULL,               \
+        .ext.flush = NULL,              \
+        .ext.reserve = NULL }
 
 #define CHUNK_SINK_INIT(CB, DRIVER) {   \
         .kind = DATA_KIND_CHUNK,        \
@@ -206,12 +268,26 @@ struct ufw_sink {
         .sink.chunk = (CB),             \
         .retry = EP_RETRY_INIT,         \
         .ext.getbuffer = NULL,          \
-        .ext.seek = NULL }
+        .ext.seek = NULL,               \
+        .ext.flush = NULL,              \
+        .ext.reserve = NULL }
+
+#define VECTOR_SINK_INIT(CB, DRIVER) {  \
+        .kind = DATA_KIND_VECTOR,        \
+        .driver = (DRIVER),              \
+        .sink.vector = (CB),             \
+        .retry = EP_RETRY_INIT,          \
+        .ext.getbuffer = NULL,           \
+        .ext.seek = NULL,                \
+        .ext.flush = NULL,               \
+        .ext.reserve = NULL }
 
 void octet_source_init(Source *instance, ByteSource source, void *driver);
 void chunk_source_init(Source *instance, ChunkSource source, void *driver);
+void vector_source_init(Source *instance, ChunksSource source, void *driver);
 void octet_sink_init(Sink *instance, ByteSink sink, void *driver);
 void chunk_sink_init(Sink *instance, ChunkSink sink, void *driver);
+void vector_sink_init(Sink *instance, ChunksSink sink, void *driver);
 
 int source_get_octet(Source *source, void *data);
 int sink_put_octet(Sink *sink, unsigned char data);
@@ -224,9 +300,21 @@ ssize_t source_get_chunk_atmost(Source *source, void *buf, size_t n);
 ssize_t sink_put_chunk(Sink *sink, const void *buf, size_t n);
 ssize_t sink_put_chunk_atmost(Sink *sink, const void *buf, size_t n);
 
+ssize_t source_read_chunks(Source *source, const ByteChunks *chunks);
+ssize_t sink_write_chunks(Sink *sink, const ByteChunks *chunks);
+ssize_t source_get_chunks(Source *source, ByteChunks *chunks);
+ssize_t sink_put_chunks(Sink *sink, ByteChunks *chunks);
+
 int source_seek(Source *source, size_t offset);
 int sink_seek(Sink *sink, size_t offset);
 
+int sink_flush(Sink *sink);
+int sink_end_of_frame(Sink *sink);
+
+ssize_t sink_reserve(Sink *sink, ByteBuffer *scratch, void **mem,
+                     size_t min, size_t max);
+ssize_t sink_commit(Sink *sink, const void *mem, size_t n);
+
 /*
  * Source to Sink Plumbing
  */
@@ -273,6 +361,16 @@ ssize_t run_write(void *driver, const void *data, size_t n);
 void sink_to_filedesc(Sink *instance, int *fd);
 #endif /* UFW_HAVE_POSIX_WRITE */
 
+#ifdef UFW_HAVE_POSIX_READV
+ssize_t run_readv(void *driver, const ByteChunks *chunks);
+void source_from_filedesc_vector(Source *instance, int *fd);
+#endif /* UFW_HAVE_POSIX_READV */
+
+#ifdef UFW_HAVE_POSIX_WRITEV
+ssize_t run_writev(void *driver, const ByteChunks *chunks);
+void sink_to_filedesc_vector(Sink *instance, int *fd);
+#endif /* UFW_HAVE_POSIX_WRITEV */
+
 /*
  * Buffer based Sources and Sinks
  */
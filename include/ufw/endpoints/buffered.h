@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#ifndef INC_UFW_ENDPOINTS_BUFFERED_H_5c0a7e31
+#define INC_UFW_ENDPOINTS_BUFFERED_H_5c0a7e31
+
+/**
+ * @addtogroup endpoints Endpoints
+ * @{
+ *
+ * @file ufw/endpoints/buffered.h
+ * @brief API for buffered endpoints
+ *
+ * A buffered source wraps another Source and puts a user supplied read-ahead
+ * buffer in front of it. Whenever the buffer runs dry, it is refilled using a
+ * single, large source_read() call on the wrapped source. All requests, be it
+ * single octets or chunks, are then served from memory.
+ *
+ * This is useful with octet oriented consumers (like the SLIP decoder or the
+ * variable length integer decoder) that are connected to sources where each
+ * access is expensive, like source_from_filedesc(), where each access maps to
+ * a read(2) system call.
+ *
+ * Buffered sources are always of kind DATA_KIND_CHUNK, regardless of the kind
+ * of the wrapped source. They implement the getbuffer extension, which allows
+ * sts_*() to move data from the read-ahead buffer to a sink without copying
+ * it into intermediate memory first.
+ *
+ * Note that a buffered source reads ahead of its consumer. Data that was read
+ * ahead and not consumed is lost, if the buffered source is abandoned.
+ *
+ * A buffered sink is the counterpart for writing. It wraps another Sink and
+ * collects data in a user supplied buffer, to write-combine many small writes
+ * into few large ones. The buffer is passed on to the wrapped sink when it is
+ * full, when sink_flush() is called on the buffered sink, and optionally when
+ * a framing protocol signals the end of a frame via sink_end_of_frame().
+ *
+ * Buffered sinks implement the getbuffer and reserve extensions as well,
+ * which let producers like sts_*() or sink_reserve() users put data straight
+ * into the sink's buffer.
+ *
+ * Data held back by a buffered sink is only passed on when the sink is
+ * flushed. Users must not forget to do that.
+ *
+ * @}
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ufw/bit-operations.h>
+#include <ufw/byte-buffer.h>
+#include <ufw/endpoints.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+typedef struct BufferedSource {
+    /* The source to read data from when the buffer runs dry. */
+    Source *source;
+    /* The read-ahead buffer. Its "offset" member points to the next octet to
+     * hand out, its "used" member marks the end of valid data. */
+    ByteBuffer *buffer;
+} BufferedSource;
+
+#define BUFFERED_SOURCE(SRC,BUF) {              \
+        .source = (SRC),                        \
+        .buffer = (BUF)                         }
+
+void buffered_source_init(Source *instance, BufferedSource *driver);
+size_t buffered_source_pending(const BufferedSource *driver);
+
+/* Pass buffered data on to the wrapped sink whenever a framing protocol
+ * signals the end of a frame. */
+#define BUFFERED_SINK_FLUSH_ON_FRAME  BITL(0)
+
+typedef struct BufferedSink {
+    /* The sink to pass data on to, when the buffer is flushed. */
+    Sink *sink;
+    /* The write-combining buffer. Data between its "offset" and "used" members
+     * has yet to be passed on to the wrapped sink. */
+    ByteBuffer *buffer;
+    /* Bit mask of BUFFERED_SINK_* flags. */
+    uint32_t flags;
+    /* Negative errno of a failed flush, that could not be returned when it
+     * happened. The next put or flush returns it. */
+    int error;
+} BufferedSink;
+
+#define BUFFERED_SINK(SNK,BUF,FLAGS) {          \
+        .sink = (SNK),                          \
+        .buffer = (BUF),                        \
+        .flags = (FLAGS),                       \
+        .error = 0                              }
+
+void buffered_sink_init(Sink *instance, BufferedSink *driver);
+size_t buffered_sink_pending(const BufferedSink *driver);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* INC_UFW_ENDPOINTS_BUFFERED_H_5c0a7e31 */
@@ -91,6 +91,14 @@ typedef struct ContinuableSink {
      * buffer offset so we can store a RPFrame instance at the beginning of the
      * block. */
     void (*postalloc)(ByteBuffer*);
+    /* Optional: A function that copies data and updates a checksum with it,
+     * like ufw_crc16_arc_memcpy(). If this is set, data is stored into the
+     * allocated buffer using this function, and ‘sum’ is the checksum of all
+     * data stored there after postalloc ran. That way, users do not have to
+     * read the data again to checksum it. Data stored in the fallback buffer
+     * is not covered. */
+    uint16_t (*chksum)(uint16_t, void*, const void*, size_t);
+    uint16_t sum;
     ContinuableIssue error;
 } ContinuableSink;
 
@@ -99,6 +107,8 @@ typedef struct ContinuableSink {
         .buffer = BYTE_BUFFER(NULL, 0U),    \
         .fallback = (FB),                   \
         .postalloc = (CB),                  \
+        .chksum = NULL,                     \
+        .sum = 0U,                          \
         .error.id = 0,                      \
         .error.datacount = 0U               }
 
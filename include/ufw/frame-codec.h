@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#ifndef INC_UFW_FRAME_CODEC_H
+#define INC_UFW_FRAME_CODEC_H
+
+/**
+ * @addtogroup framecodec Frame Codecs
+ *
+ * Common interface to ufw's framing protocols
+ *
+ * A frame codec bundles the operations of a framing protocol behind a table
+ * of function pointers: Encoding a frame from chunks of memory, decoding a
+ * frame from a source into a sink, decoding frames from data handed to the
+ * decoder in pieces of arbitrary size, and reporting the worst case overhead
+ * of the framing.
+ *
+ * Decoder state lives in a FrameCodecState, that is owned by the user of the
+ * codec, usually one per connection. That way, state like a partially
+ * received frame survives between calls.
+ *
+ * This module provides codecs for SLIP (rfc1055.h), with and without start of
+ * frame delimiter, COBS (cobs.h), and all kinds of length prefix framing
+ * (length-prefix.h). Additional codecs only need to provide an instance of
+ * FrameCodec, and if they need decoder state, a member in FrameCodecState.
+ *
+ * @{
+ *
+ * @file ufw/frame-codec.h
+ * @brief Common interface to framing protocols
+ *
+ * @}
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ufw/byte-buffer.h>
+#include <ufw/cobs.h>
+#include <ufw/compat/ssize-t.h>
+#include <ufw/endpoints.h>
+#include <ufw/length-prefix.h>
+#include <ufw/rfc1055.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * Function type used by frame_codec_feed() to deliver frames
+ *
+ * This is the same type as RFC1055FrameCallback, COBSFrameCallback and
+ * LengthPrefixFrameCallback. See those for details.
+ */
+typedef int (*FrameCallback)(void*, ByteBuffer*, int);
+
+typedef union FrameCodecState {
+    RFC1055Context slip;
+    COBSContext cobs;
+    LengthPrefixContext lenp;
+} FrameCodecState;
+
+typedef struct FrameCodec FrameCodec;
+
+struct FrameCodec {
+    /* Human readable name of the codec */
+    const char *name;
+    /* Codec specific parameter, like RFC1055 flags or a LengthPrefixKind */
+    uint32_t param;
+    /* Put decoder state into its initial state. */
+    void (*init)(const FrameCodec*, FrameCodecState*);
+    /* Encode a frame made of chunks of memory to a sink. */
+    int (*encode_chunks)(const FrameCodec*, ByteChunks*, Sink*);
+    /* Decode a frame from a source to a sink. Returns zero after a complete
+     * frame and negative errno on failure. */
+    int (*decode_into)(const FrameCodec*, FrameCodecState*, Source*, Sink*);
+    /* Return the worst case overhead of a frame with n octets of payload. */
+    size_t (*max_overhead)(const FrameCodec*, size_t);
+    /* Decode data handed to the decoder in pieces of arbitrary size. */
+    ssize_t (*feed)(const FrameCodec*, FrameCodecState*, const void*, size_t,
+                    ByteBuffer*, FrameCallback, void*);
+};
+
+extern const FrameCodec frame_codec_slip;
+extern const FrameCodec frame_codec_slip_with_sof;
+extern const FrameCodec frame_codec_cobs;
+extern const FrameCodec frame_codec_lenp_variable;
+extern const FrameCodec frame_codec_lenp_octet;
+extern const FrameCodec frame_codec_lenp_le16;
+extern const FrameCodec frame_codec_lenp_le32;
+extern const FrameCodec frame_codec_lenp_be16;
+extern const FrameCodec frame_codec_lenp_be32;
+
+const FrameCodec *frame_codec_lenp(LengthPrefixKind k);
+
+static inline void
+frame_codec_init(const FrameCodec *codec, FrameCodecState *state)
+{
+    codec->init(codec, state);
+}
+
+static inline int
+frame_codec_encode_chunks(const FrameCodec *codec, ByteChunks *chunks,
+                          Sink *sink)
+{
+    return codec->encode_chunks(codec, chunks, sink);
+}
+
+static inline int
+frame_codec_decode_into(const FrameCodec *codec, FrameCodecState *state,
+                        Source *source, Sink *sink)
+{
+    return codec->decode_into(codec, state, source, sink);
+}
+
+static inline size_t
+frame_codec_max_overhead(const FrameCodec *codec, size_t n)
+{
+    return codec->max_overhead(codec, n);
+}
+
+static inline ssize_t
+frame_codec_feed(const FrameCodec *codec, FrameCodecState *state,
+                 const void *in, size_t n, ByteBuffer *frame,
+                 FrameCallback cb, void *arg)
+{
+    return codec->feed(codec, state, in, n, frame, cb, arg);
+}
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* INC_UFW_FRAME_CODEC_H */
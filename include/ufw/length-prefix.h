@@ -68,8 +68,10 @@
 #define INC_UFW_LENGTH_PREFIX_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <ufw/byte-buffer.h>
+#include <ufw/compat/ssize-t.h>
 #include <ufw/endpoints.h>
 #include <ufw/variable-length-integer.h>
 
@@ -98,6 +100,34 @@ typedef struct ufw_length_prefix_chunks {
     ByteChunks payload;
 } LengthPrefixChunks;
 
+typedef struct ufw_length_prefix_context {
+    LengthPrefixKind kind;
+    enum {
+        LENP_READ_PREFIX,
+        LENP_READ_PAYLOAD,
+        /* Dropping the payload of a frame that did not fit into the frame
+         * buffer. */
+        LENP_SKIP_PAYLOAD
+    } state;
+    /* Prefix octets collected so far */
+    unsigned char prefix_[VARINT_64BIT_MAX_OCTETS];
+    size_t prefix;
+    /* Payload octets left in the current frame */
+    uint64_t rest;
+} LengthPrefixContext;
+
+/**
+ * Function type used by flenp_decode_feed() to deliver frames
+ *
+ * This works like RFC1055FrameCallback: Arguments are the user supplied
+ * argument, the buffer holding the decoded frame and a status code: Zero for
+ * complete frames, -EILSEQ for invalid variable-length integer prefixes, and
+ * -ENOBUFS for frames that did not fit into the frame buffer. The frame
+ * buffer is reset after the callback returns. Negative return values stop the
+ * decoder and are returned by flenp_decode_feed().
+ */
+typedef int (*LengthPrefixFrameCallback)(void*, ByteBuffer*, int);
+
 int flenp_memory_encode(LengthPrefixKind k, LengthPrefixBuffer *lpb,
                         void *buf, size_t n);
 int flenp_buffer_encode(LengthPrefixKind k, LengthPrefixBuffer *lpb,
@@ -121,6 +151,11 @@ ssize_t flenp_buffer_from_source(LengthPrefixKind k, Source *source,
 ssize_t flenp_decode_source_to_sink(LengthPrefixKind k,
                                     Source *source, Sink *sink);
 
+void flenp_context_init(LengthPrefixContext *ctx, LengthPrefixKind k);
+ssize_t flenp_decode_feed(LengthPrefixContext *ctx, const void *in, size_t n,
+                          ByteBuffer *frame, LengthPrefixFrameCallback cb,
+                          void *arg);
+
 /*
  * For backward compatibility, we implement the lenp_* functions in terms of
  * flenp_* with  kind set to LENP_VARIABLE.
@@ -46,6 +46,19 @@ typedef uint16_t (*PersistentChksum16)(const unsigned char*, size_t, uint16_t);
 /** Like PersistentChksum16 but for 32-bit checksum processing */
 typedef uint32_t (*PersistentChksum32)(const unsigned char*, size_t, uint32_t);
 
+/**
+ * Data type for extending a 16-bit checksum by zero octets
+ *
+ * Arguments are the checksum value and the number of zero octets to extend it
+ * by. Such a function only exists for checksums that are linear in GF(2),
+ * like CRCs; ufw_crc16_arc_zeros() is an example. It enables incremental
+ * checksum updates with partial stores. See persistent_sum16_zeros().
+ */
+typedef uint16_t (*PersistentChksumZeros16)(uint16_t, size_t);
+
+/** Like PersistentChksumZeros16 but for 32-bit checksums */
+typedef uint32_t (*PersistentChksumZeros32)(uint32_t, size_t);
+
 /**
  * Datatype for reading data from a medium
  *
@@ -114,6 +127,11 @@ typedef struct persistent_storage {
             PersistentChksum16 c16;
             PersistentChksum32 c32;
         } process;
+        /** Optional: Extend checksum by zero octets; NULL if unavailable */
+        union {
+            PersistentChksumZeros16 z16;
+            PersistentChksumZeros32 z32;
+        } zeros;
     } checksum;
     /** Optional buffer for checksum calculation from medium */
     struct {
@@ -150,6 +168,10 @@ void persistent_sum16(PersistentStorage *store, PersistentChksum16 f,
                       uint16_t init);
 void persistent_sum32(PersistentStorage *store, PersistentChksum32 f,
                       uint32_t init);
+void persistent_sum16_zeros(PersistentStorage *store,
+                            PersistentChksumZeros16 z);
+void persistent_sum32_zeros(PersistentStorage *store,
+                            PersistentChksumZeros32 z);
 void persistent_place(PersistentStorage *store, uint32_t address);
 void persistent_buffer(PersistentStorage *store, unsigned char *buffer,
                        size_t n);
@@ -25,7 +25,9 @@
 
 #include <ufw/allocator.h>
 #include <ufw/bit-operations.h>
+#include <ufw/compat/ssize-t.h>
 #include <ufw/endpoints.h>
+#include <ufw/frame-codec.h>
 #include <ufw/register-table.h>
 #include <ufw/toolchain.h>
 
@@ -127,19 +129,28 @@ typedef struct RPSession {
 
 typedef enum RPEndpointType {
     RP_EP_SERIAL,
-    RP_EP_TCP
+    RP_EP_TCP,
+    /* Serial links, using COBS instead of SLIP framing */
+    RP_EP_SERIAL_COBS
 } RPEndpointType;
 
 typedef struct RPEndpoint {
     RPEndpointType type;
     Source source;
     Sink sink;
+    /* Framing used with the channel; regp_use_channel() picks the default
+     * for the endpoint type, regp_use_codec() overrides it. */
+    const FrameCodec *codec;
+    /* Decoder state of the codec, which persists between frames. */
+    FrameCodecState state;
 } RPEndpoint;
 
-#define RP_ENDPOINT_NULL        \
-    { .type = RP_EP_TCP,        \
-      .source = source_empty,   \
-      .sink = sink_null         }
+#define RP_ENDPOINT_NULL                        \
+    { .type = RP_EP_TCP,                        \
+      .source = source_empty,                   \
+      .sink = sink_null,                        \
+      .codec = &frame_codec_lenp_variable,      \
+      .state.lenp.kind = LENP_VARIABLE          }
 
 typedef struct RegP {
     RPMemory memory;
@@ -209,6 +220,7 @@ void regp_use_memory8(RegP *p, RPBlockRead8 read, RPBlockWrite8 write);
 #endif /* WITH_UINT8_T */
 void regp_use_memory16(RegP *p, RPBlockRead16 read, RPBlockWrite16 write);
 void regp_use_channel(RegP *p, RPEndpointType type, Source source, Sink sink);
+void regp_use_codec(RegP *p, const FrameCodec *codec);
 void regp_use_allocator(RegP *p, BlockAllocator *alloc);
 
 /* Request API */
@@ -236,6 +248,9 @@ int regp_resp_meta(RegP *p, uint_least8_t meta);
 
 /* Processing API */
 int regp_recv(RegP *p, RPMaybeFrame *mf);
+int regp_recv_frame(RegP *p, RPMaybeFrame *mf, const void *data, size_t n);
+ssize_t regp_feed(RegP *p, const void *data, size_t n, ByteBuffer *frame,
+                  FrameCallback cb, void *arg);
 int regp_process(RegP *p, const RPMaybeFrame *mf);
 
 /* Matching API */
@@ -272,6 +287,7 @@ regaccess2blockaccess(const RegisterAccess access)
     case REG_ACCESS_READONLY:      rc.status = RP_RESP_EACCESS;   break;
     case REG_ACCESS_FAILURE:       /* FALLTHROUGH */
     case REG_ACCESS_IO_ERROR:      /* FALLTHROUGH */
+    case REG_ACCESS_MISMATCH:      /* FALLTHROUGH */
     default:                       rc.status = RP_RESP_EIO;       break;
     }
 
@@ -20,12 +20,18 @@
  * @}
  */
 
+#include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
+#include <ufw/binary-format.h>
 #include <ufw/bit-operations.h>
 
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+#include <stdatomic.h>
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -61,6 +67,7 @@ typedef enum RegisterAccessCode {
     REG_ACCESS_INVALID,
     REG_ACCESS_READONLY,
     REG_ACCESS_IO_ERROR,
+    REG_ACCESS_MISMATCH,
 } RegisterAccessCode;
 
 typedef struct RegisterAccess {
@@ -81,7 +88,11 @@ typedef enum RegisterInitCode {
     REG_INIT_ENTRY_INVALID_ORDER,
     REG_INIT_ENTRY_ADDRESS_OVERLAP,
     REG_INIT_ENTRY_IN_MEMORY_HOLE,
-    REG_INIT_ENTRY_INVALID_DEFAULT
+    REG_INIT_ENTRY_INVALID_DEFAULT,
+    REG_INIT_DIRTY_MAP_TOO_SMALL,
+    REG_INIT_AREA_NO_SHADOW,
+    REG_INIT_INDEX_TOO_SMALL,
+    REG_INIT_ENTRY_IMAGE_MISMATCH
 } RegisterInitCode;
 
 typedef struct RegisterInit {
@@ -186,7 +197,11 @@ struct RegisterEntry {
 typedef enum RegisterAreaFlags {
     REG_AF_READABLE      = (1U << 0U),
     REG_AF_WRITEABLE     = (1U << 1U),
-    REG_AF_SKIP_DEFAULTS = (1U << 2U)
+    REG_AF_SKIP_DEFAULTS = (1U << 2U),
+    /* Writes go to a shadow copy, until register_area_publish() */
+    REG_AF_DOUBLE_BUFFER = (1U << 3U),
+    /* Maintained by the library: The shadow copy is out of date. */
+    REG_AF_SHADOW_STALE  = (1U << 4U)
 } RegisterAreaFlags;
 
 #define REG_AF_RW (REG_AF_READABLE | REG_AF_WRITEABLE)
@@ -203,6 +218,17 @@ struct RegisterArea {
         RegisterOffset count;
     } entry;
     RegisterAtom *mem;
+    /* Serialised default values of a memory area. If set, register_init()
+     * copies this into mem, instead of applying defaults entry by entry. It
+     * only checks that the image holds each entry's default value. */
+    const RegisterAtom *image;
+    /* Staging buffer of double-buffered memory areas. Swapped with mem by
+     * register_area_publish(). */
+    RegisterAtom *shadow;
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+    /* Sequence counter; odd while a writer modifies the area. */
+    atomic_uint seq;
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
 #ifdef REGISTER_TABLE_WITH_AREA_USER_DATA
     void *user;
 #endif /* REGISTER_TABLE_WITH_AREA_USER_DATA */
@@ -213,7 +239,7 @@ struct RegisterArea {
       .flags = 0,                                           \
       .base = 0, .size = 0,                                 \
       .entry.first = 0, .entry.last = 0, .entry.count = 0,  \
-      .mem = NULL }
+      .mem = NULL, .image = NULL, .shadow = NULL }
 
 typedef enum RegisterTableFlags {
     REG_TF_INITIALISED = (1U << 0U),
@@ -221,13 +247,180 @@ typedef enum RegisterTableFlags {
     REG_TF_BIG_ENDIAN  = (1U << 2U)
 } RegisterTableFlags;
 
-typedef struct RegisterTable {
+/*
+ * Dirty tracking
+ *
+ * A table may carry a bitmap with one bit per entry, that is set whenever the
+ * entry is changed by register_set(), register_block_write() and the like,
+ * including register_mcopy() and register_set_from_hexstr(). The epoch is
+ * incremented with every such change. Users that need to know what changed
+ * since they last looked can take a snapshot of the bitmap (which clears it)
+ * and iterate the bits that are set in it. Entries of double-buffered areas
+ * are marked when register_area_publish() changes their value, not when a
+ * write is staged.
+ *
+ * With REGISTER_TABLE_WITH_SEQLOCK defined, writers may run concurrently, so
+ * the table's map and epoch are updated atomically, and taking a snapshot
+ * clears each word atomically. Entries' touched flags (see register_touch())
+ * are not covered by this.
+ */
+
+typedef uint32_t RegisterDirtyWord;
+#define REGISTER_DIRTY_BITS 32U
+#define REGISTER_DIRTY_WORDS(N)                                 \
+    (((N) + REGISTER_DIRTY_BITS - 1U) / REGISTER_DIRTY_BITS)
+
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+typedef atomic_uint_least32_t RegisterDirtyCell;
+typedef atomic_uint_least32_t RegisterDirtyEpoch;
+#else
+typedef RegisterDirtyWord RegisterDirtyCell;
+typedef uint32_t RegisterDirtyEpoch;
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+
+typedef struct RegisterDirty {
+    RegisterDirtyCell *map;
+    size_t words;
+    RegisterDirtyEpoch epoch;
+} RegisterDirty;
+
+#define REGISTER_DIRTY_MAP(N)                                           \
+    { .map = (RegisterDirtyCell[REGISTER_DIRTY_WORDS(N)]) { 0 },        \
+      .words = REGISTER_DIRTY_WORDS(N),                                 \
+      .epoch = 0u }
+
+typedef struct RegisterDirtyIter {
+    const RegisterDirtyWord *map;
+    size_t words;
+    size_t word;
+    RegisterDirtyWord bits;
+} RegisterDirtyIter;
+
+/*
+ * Compact entry index
+ *
+ * Entries carry a lot of data that address based lookups do not need. A
+ * table may carry an index, that register_init() fills with each entry's
+ * address and type in separate, packed arrays. Bisections and scans by
+ * address (like those in register_block_write(), register_block_read() and
+ * register_foreach_in()) then run over the index, and only access the
+ * entries they actually work with. The index needs room for all entries of
+ * the table.
+ */
+
+typedef struct RegisterIndex {
+    RegisterAddress *address;
+    uint8_t *type;
+    size_t size;
+} RegisterIndex;
+
+#define REGISTER_INDEX(N)                                       \
+    { .address = (RegisterAddress[N]) { 0 },                    \
+      .type = (uint8_t[N]) { 0 },                               \
+      .size = (N) }
+
+/*
+ * Critical sections
+ *
+ * Read-modify-write operations (register_bit_set(), register_bit_clear() and
+ * register_cas()) call these hooks around reading and writing back a
+ * register, if they are set. enter() returns a state, that is passed to
+ * leave(); on microcontrollers, this would typically save the interrupt mask
+ * before disabling interrupts, and restore it afterwards. Without the hooks,
+ * these operations are not atomic.
+ */
+
+typedef uint32_t(*registerEnterCritical)(void);
+typedef void(*registerLeaveCritical)(uint32_t);
+
+typedef struct RegisterCritical {
+    registerEnterCritical enter;
+    registerLeaveCritical leave;
+} RegisterCritical;
+
+/*
+ * Write observers
+ *
+ * A table may carry slots for observers, that are registered at run-time
+ * with register_observe(). An observer covers a range of register handles,
+ * and is notified after a successful write changed registers in that range.
+ * The notification carries the range of changed handles within the observed
+ * range: A block write results in one notification per observer, no matter
+ * how many registers it changed, and so do register_mcopy() and
+ * register_set_from_hexstr(). Loading defaults in register_init() does not
+ * notify observers. For double-buffered areas, observers are notified when
+ * register_area_publish() makes changes visible.
+ *
+ * Immediate observers are called from the writing context. Deferred
+ * observers are queued into a ring buffer instead, that is drained by
+ * register_notify_drain(), so slow observers do not stall the writer. A
+ * notification is merged into the newest queued one, if that one is for the
+ * same observer and the handle ranges overlap or are adjacent. If the queue is
+ * full, notifications are dropped and counted in the queue's ‘lost’ field.
+ * The queue's indices are updated within the table's critical section hooks,
+ * which allows the writer and the draining worker to run in different
+ * contexts. register_observe() therefore refuses deferred observers in tables
+ * that do not set these hooks.
+ */
+
+typedef struct RegisterTable RegisterTable;
+
+typedef void(*registerObserverCallback)(RegisterTable*, RegisterHandle,
+                                        RegisterHandle, void*);
+
+typedef enum RegisterNotifyMode {
+    REG_NOTIFY_IMMEDIATE = 0,
+    REG_NOTIFY_DEFERRED
+} RegisterNotifyMode;
+
+typedef struct RegisterObserver {
+    RegisterHandle first;
+    RegisterHandle last;
+    registerObserverCallback cb;
+    void *arg;
+    RegisterNotifyMode mode;
+} RegisterObserver;
+
+typedef struct RegisterNotification {
+    size_t observer;
+    RegisterHandle first;
+    RegisterHandle last;
+} RegisterNotification;
+
+typedef struct RegisterNotifyQueue {
+    RegisterNotification *slot;
+    size_t size;
+    /* Free-running; the queue holds head - tail notifications. */
+    size_t head;
+    size_t tail;
+    uint32_t lost;
+} RegisterNotifyQueue;
+
+typedef struct RegisterObservers {
+    RegisterObserver *observer;
+    size_t slots;
+    size_t count;
+    RegisterNotifyQueue queue;
+} RegisterObservers;
+
+#define REGISTER_OBSERVERS(N,Q)                                         \
+    { .observer = (RegisterObserver[N]) { { 0 } },                      \
+      .slots = (N), .count = 0u,                                        \
+      .queue.slot = (RegisterNotification[Q]) { { 0 } },                \
+      .queue.size = (Q), .queue.head = 0u, .queue.tail = 0u,            \
+      .queue.lost = 0u }
+
+struct RegisterTable {
     uint16_t flags;
     AreaHandle areas;
     RegisterArea *area;
     RegisterHandle entries;
     RegisterEntry *entry;
-} RegisterTable;
+    RegisterDirty dirty;
+    RegisterCritical critical;
+    RegisterObservers observers;
+    RegisterIndex index;
+};
 
 typedef int(*registerCallback)(RegisterTable*, RegisterHandle, void*);
 
@@ -259,6 +452,47 @@ typedef int(*registerCallback)(RegisterTable*, RegisterHandle, void*);
 #define MEMORY_AREA_RO(A,S) MAKE_MEMORY_AREA(A,S,REG_AF_READABLE)
 #define MEMORY_AREA_WO(A,S) MAKE_MEMORY_AREA(A,S,REG_AF_WRITEABLE)
 
+#define MAKE_IMAGE_AREA(ADDR,SIZE,FLAGS,IMAGE)  \
+    { .read  = reg_mem_read,                    \
+      .write = reg_mem_write,                   \
+      .flags = (FLAGS),                         \
+      .base  = (ADDR),                          \
+      .size  = (SIZE),                          \
+      .mem   = (RegisterAtom[SIZE]) { 0 },      \
+      .image = (IMAGE) }
+
+#define IMAGE_AREA(A,S,I) MAKE_IMAGE_AREA(A,S,REG_AF_RW,I)
+#define IMAGE_AREA_RO(A,S,I) MAKE_IMAGE_AREA(A,S,REG_AF_READABLE,I)
+#define IMAGE_AREA_WO(A,S,I) MAKE_IMAGE_AREA(A,S,REG_AF_WRITEABLE,I)
+
+#define MAKE_DOUBLE_BUFFERED_AREA(ADDR,SIZE,FLAGS)  \
+    { .read   = reg_mem_read,                       \
+      .write  = reg_mem_write,                      \
+      .flags  = (FLAGS) | REG_AF_DOUBLE_BUFFER,     \
+      .base   = (ADDR),                             \
+      .size   = (SIZE),                             \
+      .mem    = (RegisterAtom[SIZE]) { 0 },         \
+      .shadow = (RegisterAtom[SIZE]) { 0 } }
+
+#define DOUBLE_BUFFERED_AREA(A,S) MAKE_DOUBLE_BUFFERED_AREA(A,S,REG_AF_RW)
+
+/*
+ * Default images specify atoms as the 16-bit words they hold in the table's
+ * octet order. These turn them into the value an atom has in the system's
+ * memory.
+ */
+
+#define REG_ATOM_SWAP(W)                                \
+    ((RegisterAtom)((((W) & 0x00ffu) << 8u) | (((W) & 0xff00u) >> 8u)))
+
+#if defined(SYSTEM_ENDIANNESS_BIG)
+#define REG_ATOM_BE(W) ((RegisterAtom)(W))
+#define REG_ATOM_LE(W) REG_ATOM_SWAP(W)
+#elif defined(SYSTEM_ENDIANNESS_LITTLE)
+#define REG_ATOM_BE(W) REG_ATOM_SWAP(W)
+#define REG_ATOM_LE(W) ((RegisterAtom)(W))
+#endif /* SYSTEM_ENDIANNESS_* */
+
 /* Entry Macros */
 
 #ifdef REGISTER_TABLE_WITH_NAMES
@@ -454,11 +688,17 @@ RegisterAccess register_set_unsafe(RegisterTable *t, RegisterHandle idx,
                                    RegisterValue v);
 RegisterAccess register_get(RegisterTable *t, RegisterHandle idx,
                             RegisterValue *v);
+RegisterAccess register_get_many(RegisterTable *t, const RegisterHandle *h,
+                                 size_t n, RegisterValue *v);
+RegisterAccess register_set_many(RegisterTable *t, const RegisterHandle *h,
+                                 size_t n, const RegisterValue *v);
 
 RegisterAccess register_bit_set(RegisterTable *t, RegisterHandle idx,
                                 RegisterValue v);
 RegisterAccess register_bit_clear(RegisterTable *t, RegisterHandle idx,
                                   RegisterValue v);
+RegisterAccess register_cas(RegisterTable *t, RegisterHandle idx,
+                            RegisterValue *expected, RegisterValue desired);
 
 RegisterAccess register_default(RegisterTable *t, RegisterHandle idx,
                                 RegisterValue *v);
@@ -488,6 +728,7 @@ RegisterEntry *register_get_entry(const RegisterTable *t, RegisterHandle r);
 size_t register_entry_size(const RegisterEntry *e);
 
 RegisterAccess register_mcopy(RegisterTable *t, AreaHandle dst, AreaHandle src);
+RegisterAccess register_area_publish(RegisterTable *t, AreaHandle ah);
 bool register_value_compare(const RegisterValue *a, const RegisterValue *b);
 RegisterAccess register_compare(
     RegisterTable *t, RegisterHandle a, RegisterHandle b);
@@ -496,6 +737,18 @@ RegisterAccess register_foreach_in(RegisterTable *t, RegisterAddress addr,
                                    RegisterOffset off, registerCallback f,
                                    void *arg);
 
+uint32_t register_dirty_snapshot(RegisterTable *t, RegisterDirtyWord *dst,
+                                 size_t words);
+void register_dirty_iter(RegisterDirtyIter *it, const RegisterDirtyWord *map,
+                         size_t words);
+bool register_dirty_next(RegisterDirtyIter *it, RegisterHandle *reg);
+
+RegisterAccess register_observe(RegisterTable *t, RegisterHandle first,
+                                RegisterHandle last,
+                                registerObserverCallback cb, void *arg,
+                                RegisterNotifyMode mode);
+size_t register_notify_drain(RegisterTable *t, size_t max);
+
 static inline RegisterAddress
 register_address(RegisterTable *t, RegisterHandle reg)
 {
@@ -538,6 +791,252 @@ register_was_touched(RegisterTable *t, RegisterHandle reg)
     return BIT_ISSET(t->entry[reg].flags, REG_EF_TOUCHED);
 }
 
+static inline void
+register_mark_dirty(RegisterTable *t, RegisterHandle reg)
+{
+    if (t->dirty.map == NULL) {
+        return;
+    }
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+    atomic_fetch_or_explicit(
+        &t->dirty.map[reg / REGISTER_DIRTY_BITS],
+        (RegisterDirtyWord)1U << (reg % REGISTER_DIRTY_BITS),
+        memory_order_relaxed);
+    atomic_fetch_add_explicit(&t->dirty.epoch, 1U, memory_order_release);
+#else
+    BIT_SET(t->dirty.map[reg / REGISTER_DIRTY_BITS],
+            (RegisterDirtyWord)1U << (reg % REGISTER_DIRTY_BITS));
+    t->dirty.epoch++;
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+}
+
+static inline bool
+register_is_dirty(const RegisterTable *t, RegisterHandle reg)
+{
+    if (t->dirty.map == NULL) {
+        return false;
+    }
+    return BIT_ISSET(t->dirty.map[reg / REGISTER_DIRTY_BITS],
+                     (RegisterDirtyWord)1U << (reg % REGISTER_DIRTY_BITS));
+}
+
+static inline uint32_t
+register_dirty_epoch(const RegisterTable *t)
+{
+    return t->dirty.epoch;
+}
+
+static inline size_t
+register_notify_pending(const RegisterTable *t)
+{
+    return t->observers.queue.head - t->observers.queue.tail;
+}
+
+/*
+ * Area sequence locks
+ *
+ * With REGISTER_TABLE_WITH_SEQLOCK defined, every area carries a sequence
+ * counter. Writes to memory areas, by the library or through the memory
+ * callbacks, increment it before and after modifying the area's memory. Since
+ * writers spin while the counter is odd, they are serialised per area.
+ * Readers do not modify the counter, so they do not exclude each other or
+ * writers. They do wait, while a writer is within its section (while the
+ * counter is odd), and they repeat a read, if the counter changed while they
+ * were reading. This makes reads that span multiple registers of a single
+ * area consistent:
+ *
+ *     RegisterSequence s;
+ *     do {
+ *         s = register_area_read_begin(a);
+ *         x = register_get_u32_fast(t, X);
+ *         y = register_get_u32_fast(t, Y);
+ *     } while (register_area_read_retry(a, s));
+ *
+ * Without the macro, these functions compile to nothing, and the loop above
+ * runs exactly once. Custom areas are responsible for their own locking.
+ */
+
+typedef unsigned int RegisterSequence;
+
+static inline RegisterSequence
+register_area_read_begin(const RegisterArea *a)
+{
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+    RegisterSequence s;
+    do {
+        s = atomic_load_explicit(&a->seq, memory_order_acquire);
+    } while ((s & 1U) != 0U);
+    return s;
+#else
+    (void)a;
+    return 0U;
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+}
+
+static inline bool
+register_area_read_retry(const RegisterArea *a, RegisterSequence s)
+{
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+    atomic_thread_fence(memory_order_acquire);
+    return atomic_load_explicit(&a->seq, memory_order_relaxed) != s;
+#else
+    (void)a;
+    (void)s;
+    return false;
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+}
+
+static inline void
+register_area_write_begin(RegisterArea *a)
+{
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+    RegisterSequence s = atomic_load_explicit(&a->seq, memory_order_relaxed);
+    for (;;) {
+        if ((s & 1U) == 0U
+            && atomic_compare_exchange_weak_explicit(
+                &a->seq, &s, s + 1U,
+                memory_order_acquire, memory_order_relaxed))
+        {
+            break;
+        }
+        s = atomic_load_explicit(&a->seq, memory_order_relaxed);
+    }
+    atomic_thread_fence(memory_order_release);
+#else
+    (void)a;
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+}
+
+static inline void
+register_area_write_end(RegisterArea *a)
+{
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+    (void)atomic_fetch_add_explicit(&a->seq, 1U, memory_order_release);
+#else
+    (void)a;
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+}
+
+/*
+ * Fast accessors
+ *
+ * register_get_TYPE_fast() and register_set_TYPE_fast() access entries in
+ * memory areas directly, without going through the area's callbacks or the
+ * serialiser table. The fast path is taken for initialised tables, where the
+ * handle is valid, the entry's type matches, and the area uses the memory
+ * callbacks. Setters additionally require a trivial validator, floating
+ * point values that are zero or normal, an area that is not double buffered
+ * and a table without observers. Everything else falls back to
+ * register_get() and register_set(), so the semantics do not change.
+ *
+ * Getters return the register's value, or zero if the generic path fails or
+ * the entry is of a different type. Floating point values, that register_get()
+ * would reject, are passed to the generic path as well, and thus read as zero.
+ *
+ * The table's byte order is a runtime flag. Builds that use only one byte
+ * order may define REGISTER_TABLE_BIG_ENDIAN or REGISTER_TABLE_LITTLE_ENDIAN
+ * to resolve it at compile time. This has to match the tables' use of
+ * register_make_bigendian().
+ */
+
+static inline bool
+register_fast_bigendian(const RegisterTable *t)
+{
+#if defined(REGISTER_TABLE_BIG_ENDIAN)
+    (void)t;
+    return true;
+#elif defined(REGISTER_TABLE_LITTLE_ENDIAN)
+    (void)t;
+    return false;
+#else
+    return BIT_ISSET(t->flags, REG_TF_BIG_ENDIAN);
+#endif /* REGISTER_TABLE_*_ENDIAN */
+}
+
+static inline bool
+register_fast_entry(const RegisterTable *t, RegisterHandle idx,
+                    RegisterType type)
+{
+    return (BIT_ISSET(t->flags, REG_TF_INITIALISED)
+            && idx < t->entries
+            && t->entry[idx].type == type);
+}
+
+#define REG_FAST_ANY(V)  (true)
+#define REG_FAST_REAL(V) ((V) == 0 || isnormal(V))
+
+#define REGISTER_FAST_ACCESSORS(NAME, CTYPE, TYPE, VALID)               \
+    static inline CTYPE                                                 \
+    register_get_##NAME##_fast(RegisterTable *t, RegisterHandle idx)    \
+    {                                                                   \
+        if (register_fast_entry(t, idx, TYPE)                           \
+            && t->entry[idx].area->read == reg_mem_read)                \
+        {                                                               \
+            const RegisterEntry *e = &t->entry[idx];                    \
+            RegisterSequence s;                                         \
+            CTYPE value;                                                \
+            do {                                                        \
+                /* Publishing may swap the area's memory; reload it. */ \
+                s = register_area_read_begin(e->area);                  \
+                const RegisterAtom *p = e->area->mem + e->offset;       \
+                value = register_fast_bigendian(t)                      \
+                    ? bf_ref_##NAME##b(p) : bf_ref_##NAME##l(p);        \
+            } while (register_area_read_retry(e->area, s));             \
+            if (VALID(value)) {                                         \
+                return value;                                           \
+            }                                                           \
+        }                                                               \
+        RegisterValue v;                                                \
+        if (register_get(t, idx, &v).code != REG_ACCESS_SUCCESS         \
+            || v.type != TYPE)                                          \
+        {                                                               \
+            return (CTYPE)0;                                            \
+        }                                                               \
+        return v.value.NAME;                                            \
+    }                                                                   \
+                                                                        \
+    static inline RegisterAccess                                        \
+    register_set_##NAME##_fast(RegisterTable *t, RegisterHandle idx,    \
+                               CTYPE value)                             \
+    {                                                                   \
+        if (register_fast_entry(t, idx, TYPE)                           \
+            && t->entry[idx].check.type == REGV_TYPE_TRIVIAL            \
+            && t->entry[idx].area->write == reg_mem_write               \
+            && BIT_ISSET(t->entry[idx].area->flags,                     \
+                         REG_AF_DOUBLE_BUFFER) == false                 \
+            && t->observers.count == 0u                                 \
+            && VALID(value))                                            \
+        {                                                               \
+            const RegisterEntry *e = &t->entry[idx];                    \
+            RegisterAtom *p = e->area->mem + e->offset;                 \
+            RegisterAccess rv = REG_ACCESS_RESULT_INIT;                 \
+            register_area_write_begin(e->area);                         \
+            if (register_fast_bigendian(t)) {                           \
+                (void)bf_set_##NAME##b(p, value);                       \
+            } else {                                                    \
+                (void)bf_set_##NAME##l(p, value);                       \
+            }                                                           \
+            register_area_write_end(e->area);                           \
+            if (BIT_ISSET(t->flags, REG_TF_DURING_INIT) == false) {     \
+                register_mark_dirty(t, idx);                            \
+            }                                                           \
+            return rv;                                                  \
+        }                                                               \
+        RegisterValue v;                                                \
+        v.type = TYPE;                                                  \
+        v.value.NAME = value;                                           \
+        return register_set(t, idx, v);                                 \
+    }
+
+REGISTER_FAST_ACCESSORS(u16, uint16_t, REG_TYPE_UINT16,  REG_FAST_ANY)
+REGISTER_FAST_ACCESSORS(u32, uint32_t, REG_TYPE_UINT32,  REG_FAST_ANY)
+REGISTER_FAST_ACCESSORS(u64, uint64_t, REG_TYPE_UINT64,  REG_FAST_ANY)
+REGISTER_FAST_ACCESSORS(s16, int16_t,  REG_TYPE_SINT16,  REG_FAST_ANY)
+REGISTER_FAST_ACCESSORS(s32, int32_t,  REG_TYPE_SINT32,  REG_FAST_ANY)
+REGISTER_FAST_ACCESSORS(s64, int64_t,  REG_TYPE_SINT64,  REG_FAST_ANY)
+REGISTER_FAST_ACCESSORS(f32, float,    REG_TYPE_FLOAT32, REG_FAST_REAL)
+REGISTER_FAST_ACCESSORS(f64, double,   REG_TYPE_FLOAT64, REG_FAST_REAL)
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
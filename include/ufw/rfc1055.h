@@ -27,6 +27,8 @@
 #include <stdint.h>
 
 #include <ufw/bit-operations.h>
+#include <ufw/byte-buffer.h>
+#include <ufw/compat/ssize-t.h>
 #include <ufw/endpoints.h>
 
 #define RFC1055_WORST_CASE(n,with_sof) (((n) * 2u) + ((with_sof) ? 2u : 1u))
@@ -44,7 +46,10 @@ typedef struct rfc1055_context {
     enum {
         RFC1055_SEARCH_FOR_START,
         RFC1055_SEARCH_FOR_END,
-        RFC1055_NORMAL
+        RFC1055_NORMAL,
+        /* Only used by rfc1055_decode_feed(): Inside of a frame, with the
+         * previous octet being RAW_ESC. */
+        RFC1055_ESCAPED
     } state;
     uint32_t flags;
 } RFC1055Context;
@@ -56,9 +61,43 @@ typedef struct rfc1055_context {
     { .state = RFC1055_SEARCH_FOR_START,       \
       .flags = RFC1055_WITH_SOF }
 
+/**
+ * Function type used by rfc1055_decode_feed() to deliver frames
+ *
+ * Arguments are the user supplied argument, the buffer holding the decoded
+ * frame and a status code: Zero for complete frames, -EILSEQ for frames with
+ * invalid escape sequences, and -ENOBUFS for frames that did not fit into the
+ * frame buffer. With errors, the frame buffer holds the data decoded up to
+ * that point. The frame buffer is reset after the callback returns. Negative
+ * return values stop the decoder and are returned by rfc1055_decode_feed().
+ */
+typedef int (*RFC1055FrameCallback)(void*, ByteBuffer*, int);
+
+/**
+ * Description of a frame found by rfc1055_decode_frames()
+ *
+ * The decoded frame lives at "offset" in the buffer handed to the decoder.
+ * Status is zero for complete frames and -EILSEQ for frames with invalid
+ * escape sequences (or, with RFC1055_WITH_SOF, garbage between frames). With
+ * errors, length covers the data decoded up to the point of failure.
+ */
+typedef struct RFC1055Span {
+    size_t offset;
+    size_t length;
+    int status;
+} RFC1055Span;
+
 void rfc1055_context_init(RFC1055Context *ctx, uint32_t flags);
 int rfc1055_encode(const RFC1055Context *ctx, Source *source, Sink *sink);
+int rfc1055_encode_buffer(const RFC1055Context *ctx, const void *data,
+                          size_t n, Sink *sink);
 int rfc1055_decode(RFC1055Context *ctx, Source *source, Sink *sink);
+ssize_t rfc1055_decode_feed(RFC1055Context *ctx, const void *in, size_t n,
+                            ByteBuffer *frame, RFC1055FrameCallback cb,
+                            void *arg);
+ssize_t rfc1055_decode_frames(RFC1055Context *ctx, void *buf, size_t n,
+                              RFC1055Span *span, size_t spans,
+                              size_t *consumed);
 
 #ifdef __cplusplus
 }
@@ -131,6 +131,18 @@
  * semantics), can be next to impossible. Here you can still detect the
  * situation and establish the default behaviour of the old system.
  *
+ * Every vp_store() updates the payload checksum in the meta data header. When
+ * it replaces the whole payload, the checksum is computed while writing.
+ * Otherwise, by default, that means reading back the whole payload from
+ * memory. If the checksum can be extended by zero octets (see `struct
+ * vp_checksum`), which is the case with CRCs, vp_store() only reads back the
+ * part of the payload it replaces. This requires the payload to be verified (by vp_load(), for
+ * instance), and is enabled for the default checksum like this:
+ *
+ * @code
+ *  vp.chksum.zeros = ufw_crc16_arc_zeros;
+ * @endcode
+ *
  * On the matter of bootstrapping:
  *
  * Bootstrapping is the process of bringing a completely fresh piece of
@@ -174,6 +186,7 @@ typedef uint16_t vp_chksum;
 typedef uint16_t vp_length;
 typedef uint16_t vp_version;
 typedef vp_chksum (*vp_chksum_fnc)(vp_chksum, const void*, size_t);
+typedef vp_chksum (*vp_chksum_zeros_fnc)(vp_chksum, size_t);
 
 /** Endpoint pair and address to access physical storage */
 struct vp_access {
@@ -186,6 +199,16 @@ struct vp_access {
 struct vp_checksum {
     vp_chksum initial;
     vp_chksum_fnc process;
+    /**
+     * Optional: Extend a checksum by a number of zero octets
+     *
+     * If set, vp_store() updates the payload checksum from the previous and
+     * the new content of the part of the payload it replaces, instead of
+     * reading the whole payload. This is only possible with checksums that
+     * are linear in GF(2), like CRCs. With the default checksum, use
+     * ufw_crc16_arc_zeros().
+     */
+    vp_chksum_zeros_fnc zeros;
 };
 
 /** Meta data for storage, size and version */
@@ -520,3 +520,106 @@ byte_buffer_fill_cb(ByteBuffer *b, const size_t offset,
     b->offset = offset;
     b->used = i;
 }
+
+/**
+ * Return the amount of free space in a set of chunks
+ *
+ * Only chunks starting at the active one are taken into account.
+ *
+ * @param  c  The ByteChunks instance to use.
+ *
+ * @return The sum of byte_buffer_avail() of all chunks in question.
+ * @sideeffects None
+ */
+size_t
+byte_chunks_avail(const ByteChunks *c)
+{
+    size_t rv = 0U;
+    for (size_t i = c->active; i < c->chunks; ++i) {
+        rv += byte_buffer_avail(c->chunk + i);
+    }
+    return rv;
+}
+
+/**
+ * Return the amount of unprocessed data in a set of chunks
+ *
+ * Only chunks starting at the active one are taken into account.
+ *
+ * @param  c  The ByteChunks instance to use.
+ *
+ * @return The sum of byte_buffer_rest() of all chunks in question.
+ * @sideeffects None
+ */
+size_t
+byte_chunks_rest(const ByteChunks *c)
+{
+    size_t rv = 0U;
+    for (size_t i = c->active; i < c->chunks; ++i) {
+        rv += byte_buffer_rest(c->chunk + i);
+    }
+    return rv;
+}
+
+/**
+ * Mark data in a set of chunks as read
+ *
+ * This moves the process marks of chunks forward, starting at the active one,
+ * until SIZE bytes are accounted for. The active chunk is moved forward past
+ * all chunks that were exhausted.
+ *
+ * @param  c     The ByteChunks instance to use.
+ * @param  size  The number of bytes to mark as read.
+ *
+ * @return The number of bytes that could be marked as read.
+ * @sideeffects Modifies meta data of the ByteChunks instance and its chunks.
+ */
+size_t
+byte_chunks_markread(ByteChunks *c, size_t size)
+{
+    size_t done = 0U;
+    while (c->active < c->chunks) {
+        ByteBuffer *b = c->chunk + c->active;
+        const size_t rest = byte_buffer_rest(b);
+        const size_t m = (size - done) < rest ? (size - done) : rest;
+        b->offset += m;
+        done += m;
+        if (byte_buffer_rest(b) > 0U) {
+            break;
+        }
+        c->active++;
+    }
+    return done;
+}
+
+/**
+ * Mark space in a set of chunks as written
+ *
+ * This is the counterpart to byte_chunks_markread() for filling chunks: It
+ * moves the used marks of chunks forward, starting at the active one, until
+ * SIZE bytes are accounted for. The active chunk is moved forward past all
+ * chunks that were filled up.
+ *
+ * @param  c     The ByteChunks instance to use.
+ * @param  size  The number of bytes to mark as written.
+ *
+ * @return The number of bytes that could be marked as written.
+ * @sideeffects Modifies meta data of the ByteChunks instance and its chunks.
+ */
+size_t
+byte_chunks_markwritten(ByteChunks *c, size_t size)
+{
+    size_t done = 0U;
+    while (c->active < c->chunks) {
+        ByteBuffer *b = c->chunk + c->active;
+        const size_t avail = byte_buffer_avail(b);
+        const size_t m = (size - done) < avail ? (size - done) : avail;
+        b->used += m;
+        done += m;
+        if (byte_buffer_avail(b) > 0U) {
+            break;
+        }
+        c->active++;
+    }
+    return done;
+}
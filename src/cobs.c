@@ -0,0 +1,502 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+/**
+ * @addtogroup protocobs Consistent Overhead Byte Stuffing (COBS)
+ * @{
+ *
+ * @file cobs.c
+ * @brief Consistent Overhead Byte Stuffing
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ufw/compat/errno.h>
+#include <ufw/compat/ssize-t.h>
+
+#include <ufw/byte-buffer.h>
+#include <ufw/cobs.h>
+#include <ufw/compiler.h>
+#include <ufw/endpoints.h>
+
+/**
+ * Frame delimiter
+ *
+ * This is the only octet value that never appears in encoded data.
+ */
+#define COBS_DELIMITER 0x00u
+
+/**
+ * Code octet of a block without implied zero
+ *
+ * Blocks with this code hold COBS_BLOCK_SIZE octets of payload, and are not
+ * followed by a zero in the decoded data.
+ */
+#define COBS_FULL_BLOCK 0xffu
+
+#define MAYBE_RETURN(EXPR)                      \
+    do {                                        \
+        int ufw_return_code = EXPR;             \
+        if (ufw_return_code < 0) {              \
+            return ufw_return_code;             \
+        }                                       \
+    } while (0)
+
+void
+cobs_context_init(COBSContext *ctx)
+{
+    ctx->state = COBS_START;
+    ctx->remaining = 0U;
+    ctx->zero = false;
+}
+
+static inline int
+cobs_close(Sink *sink)
+{
+    const int rc = sink_put_octet(sink, COBS_DELIMITER);
+    return rc < 0 ? rc : 0;
+}
+
+/**
+ * Function type used by cobs_blocks() to emit blocks
+ *
+ * Arguments are the user supplied argument, the block's code octet, and the
+ * block's payload and its size.
+ */
+typedef int (*COBSEmitBlock)(void*, unsigned char, const unsigned char*,
+                             size_t);
+
+/**
+ * Split payload in memory into COBS blocks
+ *
+ * Zero octets are located using memchr(). Each block is handed to the emit
+ * callback straight from the payload memory.
+ *
+ * @param  p     Pointer to the payload
+ * @param  n     Size of the payload
+ * @param  emit  Callback to hand blocks to
+ * @param  arg   Argument handed to the callback
+ *
+ * @return Negative value returned by the callback; zero otherwise.
+ * @sideeffects Calls emit.
+ */
+static int
+cobs_blocks(const unsigned char *p, size_t n, COBSEmitBlock emit, void *arg)
+{
+    for (;;) {
+        const size_t max = n < COBS_BLOCK_SIZE ? n : COBS_BLOCK_SIZE;
+        const unsigned char *zero = (max > 0U)
+            ? memchr(p, COBS_DELIMITER, max)
+            : NULL;
+
+        if (zero == NULL && max == COBS_BLOCK_SIZE) {
+            MAYBE_RETURN(emit(arg, COBS_FULL_BLOCK, p, max));
+            p += max;
+            n -= max;
+            if (n == 0U) {
+                return 0;
+            }
+            continue;
+        }
+
+        const size_t run = (zero == NULL) ? max : (size_t)(zero - p);
+        MAYBE_RETURN(emit(arg, (unsigned char)(run + 1U), p, run));
+        if (zero == NULL) {
+            return 0;
+        }
+        /* With a zero as the last octet of the payload, this continues with
+         * n being zero, which produces the required empty block. */
+        p += run + 1U;
+        n -= run + 1U;
+    }
+}
+
+static int
+cobs_block_to_sink(void *arg, const unsigned char code,
+                   const unsigned char *p, const size_t n)
+{
+    Sink *sink = arg;
+    MAYBE_RETURN(sink_put_octet(sink, code));
+    if (n > 0U) {
+        const ssize_t rc = sink_put_chunk(sink, p, n);
+        if (rc < 0) {
+            return (int)rc;
+        }
+    }
+
+    return 0;
+}
+
+static int
+cobs_block_to_memory(void *arg, const unsigned char code,
+                     const unsigned char *p, const size_t n)
+{
+    unsigned char **dst = arg;
+    (*dst)[0] = code;
+    memcpy(*dst + 1U, p, n);
+    *dst += n + 1U;
+    return 0;
+}
+
+/**
+ * Encode a frame into memory reserved in a sink
+ *
+ * The worst case size of the frame is reserved, which allows the encoder to
+ * produce the frame without checking for space, and to hand it to the sink
+ * in a single write.
+ *
+ * @param  p     Pointer to the payload
+ * @param  n     Size of the payload
+ * @param  sink  Pointer to the sink to write the frame to
+ *
+ * @return Negative errno on failure, -ENOMEM if the sink could not offer
+ *         enough memory; zero otherwise.
+ * @sideeffects Writes to the sink.
+ */
+static int
+cobs_encode_reserved(const unsigned char *p, const size_t n, Sink *sink)
+{
+    if (n > SSIZE_MAX / 2U) {
+        return -ENOMEM;
+    }
+
+    void *mem;
+    const size_t worst = COBS_WORST_CASE(n);
+    const ssize_t rc = sink_reserve(sink, NULL, &mem, worst, worst);
+    if (rc < 0) {
+        return (int)rc;
+    }
+
+    unsigned char *start = mem;
+    unsigned char *dst = start;
+    (void)cobs_blocks(p, n, cobs_block_to_memory, &dst);
+    *dst++ = COBS_DELIMITER;
+    const ssize_t rcsink = sink_commit(sink, mem, (size_t)(dst - start));
+    return (rcsink < 0) ? (int)rcsink : 0;
+}
+
+/**
+ * Encode a frame from a source
+ *
+ * Payload is read into a block buffer on the stack, which is handed to the
+ * sink, code octet included, whenever a zero octet ends the block or when the
+ * block is full. The frame is terminated by a delimiter.
+ *
+ * @param  source  Pointer to the source to read payload from
+ * @param  sink    Pointer to the sink to write the frame to
+ *
+ * @return Negative errno on failure; zero otherwise.
+ * @sideeffects Reads from source and writes to sink.
+ */
+int
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+cobs_encode(Source *source, Sink *sink)
+{
+    /* Code octet, followed by the block's payload. */
+    unsigned char block[1U + COBS_BLOCK_SIZE];
+    size_t used = 0U;
+    bool after_full = false;
+
+    for (;;) {
+        unsigned char *fresh = block + 1U + used;
+        const ssize_t get = source_read(source, fresh, COBS_BLOCK_SIZE - used);
+        if (get == -ENODATA || get == 0) {
+            break;
+        } else if (get < 0) {
+            return (int)get;
+        }
+
+        size_t rest = (size_t)get;
+        while (rest > 0U) {
+            const unsigned char *zero = memchr(fresh, COBS_DELIMITER, rest);
+            if (zero == NULL) {
+                used += rest;
+                break;
+            }
+
+            const size_t run = (size_t)(zero - fresh);
+            used += run;
+            block[0] = (unsigned char)(used + 1U);
+            const ssize_t rc = sink_put_chunk(sink, block, used + 1U);
+            if (rc < 0) {
+                return (int)rc;
+            }
+            after_full = false;
+
+            /* Data following the zero starts the next block. */
+            rest -= run + 1U;
+            memmove(block + 1U, zero + 1, rest);
+            fresh = block + 1U;
+            used = 0U;
+        }
+
+        if (used == COBS_BLOCK_SIZE) {
+            block[0] = COBS_FULL_BLOCK;
+            const ssize_t rc = sink_put_chunk(sink, block, sizeof(block));
+            if (rc < 0) {
+                return (int)rc;
+            }
+            after_full = true;
+            used = 0U;
+        }
+    }
+
+    /* A full block at the very end of the payload does not need to be
+     * followed by an empty block, since it implies no zero octet. */
+    if (used > 0U || after_full == false) {
+        block[0] = (unsigned char)(used + 1U);
+        const ssize_t rc = sink_put_chunk(sink, block, used + 1U);
+        if (rc < 0) {
+            return (int)rc;
+        }
+    }
+
+    MAYBE_RETURN(cobs_close(sink));
+    return sink_end_of_frame(sink);
+}
+
+/**
+ * Encode a frame from memory
+ *
+ * This is the bulk variant of cobs_encode(). Zero octets are located using
+ * memchr(). If the sink implements the reserve extension, the whole frame is
+ * produced in the sink's memory. Otherwise the blocks between zero octets are
+ * handed to the sink straight from the payload memory, without copying them
+ * to intermediate memory.
+ *
+ * @param  data  Pointer to the payload to encode
+ * @param  n     Size of the payload
+ * @param  sink  Pointer to the sink to write the frame to
+ *
+ * @return Negative errno on failure; zero otherwise.
+ * @sideeffects Writes to the sink.
+ */
+int
+cobs_encode_buffer(const void *data, const size_t n, Sink *sink)
+{
+    const int rc = (sink->ext.reserve == NULL)
+        ? -ENOMEM
+        : cobs_encode_reserved(data, n, sink);
+
+    if (rc == -ENOMEM) {
+        MAYBE_RETURN(cobs_blocks(data, n, cobs_block_to_sink, sink));
+        MAYBE_RETURN(cobs_close(sink));
+    } else if (rc < 0) {
+        return rc;
+    }
+
+    return sink_end_of_frame(sink);
+}
+
+/**
+ * Decode a frame from a source
+ *
+ * This reads data from the source octet by octet, and writes the decoded
+ * payload to the sink, until the delimiter that ends a frame is found.
+ * Delimiters at the start of a frame are skipped. A delimiter in the middle
+ * of a block causes -EILSEQ to be returned; since that delimiter terminates
+ * the broken frame, decoding the next frame can continue right away.
+ *
+ * @param  ctx     Pointer to the COBS context to use
+ * @param  source  Pointer to the source to read from
+ * @param  sink    Pointer to the sink to write the decoded payload to
+ *
+ * @return Negative errno on failure; one after a complete frame.
+ * @sideeffects Modifies ctx, reads from source and writes to sink.
+ */
+int
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+cobs_decode(COBSContext *ctx, Source *source, Sink *sink)
+{
+    for (;;) {
+        unsigned char data = 0U;
+        MAYBE_RETURN(source_get_octet(source, &data));
+
+        switch (ctx->state) {
+        case COBS_SEARCH_FOR_END:
+            if (data == COBS_DELIMITER) {
+                ctx->state = COBS_START;
+            }
+            break;
+        case COBS_DATA:
+            if (data == COBS_DELIMITER) {
+                cobs_context_init(ctx);
+                return -EILSEQ;
+            }
+            MAYBE_RETURN(sink_put_octet(sink, data));
+            ctx->remaining--;
+            if (ctx->remaining == 0U) {
+                ctx->state = COBS_CODE;
+            }
+            break;
+        case COBS_START: /* FALLTHROUGH */
+        case COBS_CODE:  /* FALLTHROUGH */
+        default:
+            if (data == COBS_DELIMITER) {
+                if (ctx->state == COBS_START) {
+                    break;
+                }
+                cobs_context_init(ctx);
+                return 1;
+            }
+            if (ctx->zero) {
+                MAYBE_RETURN(sink_put_octet(sink, 0U));
+            }
+            ctx->remaining = (uint8_t)(data - 1U);
+            ctx->zero = (data != COBS_FULL_BLOCK);
+            ctx->state = (ctx->remaining > 0U) ? COBS_DATA : COBS_CODE;
+            break;
+        }
+    }
+
+    /* NOTREACHED */
+}
+
+/**
+ * Hand a frame to the user of cobs_decode_feed()
+ *
+ * @param  ctx     Pointer to the COBS context in use
+ * @param  state   State to continue decoding in
+ * @param  frame   Pointer to the frame buffer
+ * @param  status  Status code of the frame
+ * @param  cb      Frame callback to call
+ * @param  arg     Argument for the callback
+ *
+ * @return Return value of the callback.
+ * @sideeffects Modifies ctx, calls cb and resets the frame buffer.
+ */
+static inline int
+cobs_deliver(COBSContext *ctx, const int state, ByteBuffer *frame,
+             const int status, COBSFrameCallback cb, void *arg)
+{
+    cobs_context_init(ctx);
+    ctx->state = state;
+    const int rc = cb(arg, frame, status);
+    byte_buffer_reset(frame);
+    return rc;
+}
+
+/**
+ * Decode a chunk of COBS encoded data
+ *
+ * This is the counterpart of rfc1055_decode_feed(): Data is handed to the
+ * decoder as it arrives, in pieces of arbitrary size, and all state needed to
+ * continue with the next piece is kept in the context. Blocks are copied to
+ * the frame buffer in one go, and the delimiter is located using memchr().
+ * Completed frames, and frames that failed to decode, are handed to the
+ * callback, after which the frame buffer is reset.
+ *
+ * A frame that does not fit into the frame buffer is delivered with -ENOBUFS,
+ * and the rest of it is dropped. A frame that ends in the middle of a block
+ * is delivered with -EILSEQ.
+ *
+ * Decoded data is always shorter than its encoded form, so the frame buffer
+ * may share memory with the input, as long as the input does not start
+ * before the frame buffer's write pointer.
+ *
+ * @param  ctx    Pointer to the COBS context to use
+ * @param  in     Pointer to encoded data
+ * @param  n      Size of the encoded data
+ * @param  frame  Pointer to the buffer to decode frames into
+ * @param  cb     Callback to hand frames to
+ * @param  arg    Argument handed to the callback
+ *
+ * @return Negative value returned by the callback, which stops decoding
+ *         after the frame in question; the amount of data consumed (n)
+ *         otherwise.
+ * @sideeffects Modifies ctx and frame; calls cb.
+ */
+ssize_t
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+cobs_decode_feed(COBSContext *ctx, const void *in, const size_t n,
+                 ByteBuffer *frame, COBSFrameCallback cb, void *arg)
+{
+    if (n > SSIZE_MAX) {
+        return -EINVAL;
+    }
+
+    const unsigned char *p = in;
+    size_t rest = n;
+
+    while (rest > 0U) {
+        switch (ctx->state) {
+        case COBS_SEARCH_FOR_END: {
+            const unsigned char *end = memchr(p, COBS_DELIMITER, rest);
+            if (end == NULL) {
+                rest = 0U;
+                break;
+            }
+            rest -= (size_t)(end - p) + 1U;
+            p = end + 1;
+            ctx->state = COBS_START;
+            break;
+        }
+        case COBS_DATA: {
+            const size_t max = (rest < ctx->remaining) ? rest : ctx->remaining;
+            const unsigned char *end = memchr(p, COBS_DELIMITER, max);
+            const size_t run = (end == NULL) ? max : (size_t)(end - p);
+            if (run > byte_buffer_avail(frame)) {
+                p += run;
+                rest -= run;
+                MAYBE_RETURN(cobs_deliver(ctx, COBS_SEARCH_FOR_END,
+                                          frame, -ENOBUFS, cb, arg));
+                break;
+            }
+            unsigned char *dst = byte_buffer_writeptr(frame);
+            if (dst != p) {
+                memmove(dst, p, run);
+            }
+            frame->used += run;
+            p += run;
+            rest -= run;
+            if (end != NULL) {
+                p++;
+                rest--;
+                MAYBE_RETURN(cobs_deliver(ctx, COBS_START,
+                                          frame, -EILSEQ, cb, arg));
+                break;
+            }
+            ctx->remaining = (uint8_t)(ctx->remaining - run);
+            if (ctx->remaining == 0U) {
+                ctx->state = COBS_CODE;
+            }
+            break;
+        }
+        case COBS_START: /* FALLTHROUGH */
+        case COBS_CODE:  /* FALLTHROUGH */
+        default: {
+            const unsigned char data = *p++;
+            rest--;
+            if (data == COBS_DELIMITER) {
+                if (ctx->state == COBS_CODE) {
+                    MAYBE_RETURN(cobs_deliver(ctx, COBS_START,
+                                              frame, 0, cb, arg));
+                }
+                break;
+            }
+            if (ctx->zero) {
+                if (byte_buffer_avail(frame) == 0U) {
+                    MAYBE_RETURN(cobs_deliver(ctx, COBS_SEARCH_FOR_END,
+                                              frame, -ENOBUFS, cb, arg));
+                    break;
+                }
+                frame->data[frame->used++] = 0U;
+            }
+            ctx->remaining = (uint8_t)(data - 1U);
+            ctx->zero = (data != COBS_FULL_BLOCK);
+            ctx->state = (ctx->remaining > 0U) ? COBS_DATA : COBS_CODE;
+            break;
+        }
+        }
+    }
+
+    return (ssize_t)n;
+}
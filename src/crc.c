@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+/**
+ * @addtogroup checksums Checksum Algorithms
+ * @{
+ *
+ * @file crc.c
+ * @brief Generic CRC engine support functions
+ *
+ * @}
+ */
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ufw/crc/crc.h>
+
+#if (CHAR_BIT == 8u) && defined(__GNUC__) && defined(__x86_64__)
+#define CRC_WITH_PCLMUL
+#include <immintrin.h>
+#endif /* x86_64 */
+
+#if (CHAR_BIT == 8u) && defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN) \
+    && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define CRC_WITH_PMULL
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#include <asm/hwcap.h>
+#endif /* __linux__ */
+#endif /* aarch64 */
+
+/**
+ * Reverse the order of the lower bits of a value
+ *
+ * @param  value  The value to reflect
+ * @param  width  Number of bits to reflect (1 to 64)
+ *
+ * @return The reflected value.
+ * @sideeffects None
+ */
+uint64_t
+ufw_crc_reflect(uint64_t value, const unsigned int width)
+{
+    uint64_t rv = 0U;
+    for (unsigned int i = 0U; i < width; ++i) {
+        rv = (rv << 1U) | (value & 1U);
+        value >>= 1U;
+    }
+    return rv;
+}
+
+/*
+ * Polynomials modulo the CRC polynomial P, in the orientation of the register:
+ * For reflected CRCs, the coefficient of x^0 is the top bit of the register,
+ * otherwise it is the lowest bit.
+ */
+static uint64_t
+crc_one(const unsigned int width, const bool reflected)
+{
+    return reflected ? ((uint64_t)1U << (width - 1U)) : 1U;
+}
+
+static uint64_t
+crc_times_x(uint64_t a, const unsigned int width, const uint64_t poly,
+            const uint64_t rpoly, const bool reflected)
+{
+    if (reflected) {
+        return ((a & 1U) != 0U) ? ((a >> 1U) ^ rpoly) : (a >> 1U);
+    }
+    const uint64_t top = (uint64_t)1U << (width - 1U);
+    const uint64_t mask = (top - 1U) | top;
+    return (((a & top) != 0U) ? ((a << 1U) ^ poly) : (a << 1U)) & mask;
+}
+
+/* a * b mod P: Sum up b * x^k for all terms x^k of a. */
+static uint64_t
+crc_multiply(uint64_t a, uint64_t b, const unsigned int width,
+             const uint64_t poly, const uint64_t rpoly, const bool reflected)
+{
+    uint64_t sum = 0U;
+    for (uint64_t k = crc_one(width, reflected); a != 0U;) {
+        if ((a & k) != 0U) {
+            sum ^= b;
+            a ^= k;
+        }
+        k = reflected ? (k >> 1U) : (k << 1U);
+        b = crc_times_x(b, width, poly, rpoly, reflected);
+    }
+    return sum;
+}
+
+/**
+ * Extend a CRC register by a number of zero octets
+ *
+ * This returns the register value after processing ‘n’ zero octets, without
+ * processing these octets: The register holds a polynomial modulo the CRC
+ * polynomial P, and processing n zero octets multiplies it by x^(8n) mod P.
+ * That power is computed by repeated squaring, which makes the cost O(log(n))
+ * multiplications of O(width) steps each.
+ *
+ * The register is in the orientation of the algorithm, ie. bit-reflected for
+ * reflected CRCs. Initial value and final XOR are not applied.
+ *
+ * @param  reg        Register value
+ * @param  n          Number of zero octets to extend the register by
+ * @param  width      Width of the CRC in bits (1 to 64)
+ * @param  poly       CRC polynomial, not reflected, without the x^width term
+ * @param  reflected  true for bit-reflected CRCs
+ *
+ * @return Updated register value.
+ * @sideeffects None
+ */
+uint64_t
+ufw_crc_zeros(uint64_t reg, size_t n, const unsigned int width,
+              const uint64_t poly, const bool reflected)
+{
+    if (n == 0U || reg == 0U || width == 0U || width > 64U) {
+        return reg;
+    }
+
+    const uint64_t rpoly = reflected ? ufw_crc_reflect(poly, width) : 0U;
+
+    /* x^8 mod P; the square of this is x^16, and so on. */
+    uint64_t power = crc_one(width, reflected);
+    for (unsigned int i = 0U; i < 8U; ++i) {
+        power = crc_times_x(power, width, poly, rpoly, reflected);
+    }
+
+    for (;;) {
+        if ((n & 1U) != 0U) {
+            reg = crc_multiply(power, reg, width, poly, rpoly, reflected);
+        }
+        n >>= 1U;
+        if (n == 0U) {
+            break;
+        }
+        power = crc_multiply(power, power, width, poly, rpoly, reflected);
+    }
+
+    return reg;
+}
+
+/*
+ * Carry-less multiplication
+ *
+ * The input is folded into a 128 bit accumulator: With the accumulator A
+ * being the polynomial A_h * x^64 + A_l, data D bits further down the message
+ * is updated like this:
+ *
+ *     D' = D + A_h * (x^(D+64) mod P) + A_l * (x^D mod P)
+ *
+ * That keeps D' congruent to the message modulo the CRC polynomial P, which
+ * is all the CRC depends on. Four accumulators are used in parallel, to hide
+ * the latency of the multiplication. In the end they are folded into one,
+ * and the CRC of that accumulator (and of any data that remains) is computed
+ * by the caller, using its table driven implementation.
+ *
+ * Because the CRC is bit-reflected, so are the constants. Multiplying two
+ * reflected 64 bit values yields the reflected product shifted by one bit,
+ * which is accounted for by using x^(k-1) instead of x^k. The constants are
+ * ordered like this, with bit 63 holding the coefficient of x^0:
+ *
+ *     k[0] = x^191 mod P, k[1] = x^127 mod P,
+ *     k[2] = x^575 mod P, k[3] = x^511 mod P
+ *
+ * This works for all reflected CRCs of up to 64 bits. The tool that
+ * generates the CRC tables computes these constants as well.
+ */
+
+#if defined(CRC_WITH_PCLMUL)
+#define CRC_CLMUL_TARGET __attribute__((target("sse2,pclmul")))
+
+CRC_CLMUL_TARGET
+static inline __m128i
+crc_fold(const __m128i acc, const __m128i k, const __m128i data)
+{
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(acc, k, 0x00),
+                                       _mm_clmulepi64_si128(acc, k, 0x11)),
+                         data);
+}
+
+CRC_CLMUL_TARGET
+static size_t
+crc_clmul(const uint64_t *k, const uint64_t reg,
+          const unsigned char *src, size_t n, unsigned char *acc)
+{
+    const size_t total = n;
+    const __m128i k128 = _mm_set_epi64x((long long)k[1], (long long)k[0]);
+    const __m128i k512 = _mm_set_epi64x((long long)k[3], (long long)k[2]);
+    const __m128i *p = (const __m128i*)(const void*)src;
+    __m128i x0 = _mm_xor_si128(_mm_loadu_si128(p),
+                               _mm_cvtsi64_si128((long long)reg));
+    __m128i x1 = _mm_loadu_si128(p + 1);
+    __m128i x2 = _mm_loadu_si128(p + 2);
+    __m128i x3 = _mm_loadu_si128(p + 3);
+    p += 4;
+    n -= UFW_CRC_FOLD_MIN;
+
+    while (n >= UFW_CRC_FOLD_MIN) {
+        x0 = crc_fold(x0, k512, _mm_loadu_si128(p));
+        x1 = crc_fold(x1, k512, _mm_loadu_si128(p + 1));
+        x2 = crc_fold(x2, k512, _mm_loadu_si128(p + 2));
+        x3 = crc_fold(x3, k512, _mm_loadu_si128(p + 3));
+        p += 4;
+        n -= UFW_CRC_FOLD_MIN;
+    }
+
+    x1 = crc_fold(x0, k128, x1);
+    x2 = crc_fold(x1, k128, x2);
+    x3 = crc_fold(x2, k128, x3);
+    while (n >= 16U) {
+        x3 = crc_fold(x3, k128, _mm_loadu_si128(p));
+        p++;
+        n -= 16U;
+    }
+
+    _mm_storeu_si128((__m128i*)(void*)acc, x3);
+    return total - n;
+}
+
+static bool
+crc_clmul_supported(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul");
+}
+#endif /* CRC_WITH_PCLMUL */
+
+#if defined(CRC_WITH_PMULL)
+static inline uint64x2_t
+crc_fold(const uint64x2_t acc, const poly64x2_t k, const uint64x2_t data)
+{
+    const poly64x2_t a = vreinterpretq_p64_u64(acc);
+    const poly128_t lo = vmull_p64(vgetq_lane_p64(a, 0), vgetq_lane_p64(k, 0));
+    const poly128_t hi = vmull_high_p64(a, k);
+    return veorq_u64(veorq_u64(vreinterpretq_u64_p128(lo),
+                               vreinterpretq_u64_p128(hi)),
+                     data);
+}
+
+static inline uint64x2_t
+crc_load(const unsigned char *src)
+{
+    return vreinterpretq_u64_u8(vld1q_u8(src));
+}
+
+static size_t
+crc_clmul(const uint64_t *k, const uint64_t reg,
+          const unsigned char *src, size_t n, unsigned char *acc)
+{
+    const size_t total = n;
+    const poly64x2_t k128 = vreinterpretq_p64_u64(
+        vcombine_u64(vcreate_u64(k[0]), vcreate_u64(k[1])));
+    const poly64x2_t k512 = vreinterpretq_p64_u64(
+        vcombine_u64(vcreate_u64(k[2]), vcreate_u64(k[3])));
+    uint64x2_t x0 = veorq_u64(crc_load(src),
+                              vcombine_u64(vcreate_u64(reg), vcreate_u64(0U)));
+    uint64x2_t x1 = crc_load(src + 16U);
+    uint64x2_t x2 = crc_load(src + 32U);
+    uint64x2_t x3 = crc_load(src + 48U);
+    src += UFW_CRC_FOLD_MIN;
+    n -= UFW_CRC_FOLD_MIN;
+
+    while (n >= UFW_CRC_FOLD_MIN) {
+        x0 = crc_fold(x0, k512, crc_load(src));
+        x1 = crc_fold(x1, k512, crc_load(src + 16U));
+        x2 = crc_fold(x2, k512, crc_load(src + 32U));
+        x3 = crc_fold(x3, k512, crc_load(src + 48U));
+        src += UFW_CRC_FOLD_MIN;
+        n -= UFW_CRC_FOLD_MIN;
+    }
+
+    x1 = crc_fold(x0, k128, x1);
+    x2 = crc_fold(x1, k128, x2);
+    x3 = crc_fold(x2, k128, x3);
+    while (n >= 16U) {
+        x3 = crc_fold(x3, k128, crc_load(src));
+        src += 16U;
+        n -= 16U;
+    }
+
+    vst1q_u8(acc, vreinterpretq_u8_u64(x3));
+    return total - n;
+}
+
+static bool
+crc_clmul_supported(void)
+{
+#if defined(__linux__) && defined(HWCAP_PMULL)
+    return (getauxval(AT_HWCAP) & HWCAP_PMULL) != 0U;
+#else
+    /* The compiler was told to target a CPU with PMULL. */
+    return true;
+#endif /* __linux__ && HWCAP_PMULL */
+}
+#endif /* CRC_WITH_PMULL */
+
+#if defined(CRC_WITH_PCLMUL) || defined(CRC_WITH_PMULL)
+static enum {
+    CRC_FOLD_UNKNOWN = 0,
+    CRC_FOLD_SUPPORTED,
+    CRC_FOLD_UNSUPPORTED
+} crc_fold_support = CRC_FOLD_UNKNOWN;
+#endif /* CRC_WITH_PCLMUL || CRC_WITH_PMULL */
+
+/**
+ * Check if carry-less multiplication can be used to fold CRC input
+ *
+ * This is true if the library was built for x86_64 or for AArch64 with the
+ * crypto extension, and if the machine running the code supports PCLMULQDQ
+ * or PMULL respectively. CPU feature detection is done with the first call.
+ *
+ * @return true if ufw_crc_fold() is operational, false otherwise.
+ * @sideeffects Caches the result of CPU feature detection.
+ */
+bool
+ufw_crc_fold_available(void)
+{
+#if defined(CRC_WITH_PCLMUL) || defined(CRC_WITH_PMULL)
+    if (crc_fold_support == CRC_FOLD_UNKNOWN) {
+        crc_fold_support = crc_clmul_supported()
+            ? CRC_FOLD_SUPPORTED : CRC_FOLD_UNSUPPORTED;
+    }
+    return crc_fold_support == CRC_FOLD_SUPPORTED;
+#else
+    return false;
+#endif /* CRC_WITH_PCLMUL || CRC_WITH_PMULL */
+}
+
+/**
+ * Fold input of a reflected CRC into a 128 bit accumulator
+ *
+ * This processes a multiple of sixteen octets from the start of the buffer,
+ * at least UFW_CRC_FOLD_MIN octets, with the current register value XORed
+ * into the first octets. The CRC of these octets is the CRC of the sixteen
+ * octets in ‘acc’ with a register value of zero. The remaining input has to
+ * be processed after that.
+ *
+ * @param  k       Four folding constants for the CRC polynomial
+ * @param  reg     Current register value
+ * @param  buffer  Data pointer
+ * @param  n       Number of octets in the buffer
+ * @param  acc     Memory to store the accumulator in (sixteen octets)
+ *
+ * @return Number of octets processed; zero if folding is not available, or
+ *         if the buffer is too short.
+ * @sideeffects None
+ */
+size_t
+ufw_crc_fold(const uint64_t *k, const uint64_t reg,
+             const void *buffer, const size_t n, unsigned char *acc)
+{
+#if defined(CRC_WITH_PCLMUL) || defined(CRC_WITH_PMULL)
+    if (n < UFW_CRC_FOLD_MIN || ufw_crc_fold_available() == false) {
+        return 0U;
+    }
+    return crc_clmul(k, reg, buffer, n, acc);
+#else
+    (void)k;
+    (void)reg;
+    (void)buffer;
+    (void)n;
+    (void)acc;
+    return 0U;
+#endif /* CRC_WITH_PCLMUL || CRC_WITH_PMULL */
+}
@@ -55,6 +55,16 @@ write_to_buffer(void *driver, const void *data, size_t n)
     ByteBuffer *b = driver;
     ssize_t value = n;
 
+    /* Data produced into memory handed out by reserve_in_buffer() is in
+     * place already; all that is left to do is to account for it. */
+    if (data == byte_buffer_writeptr(b)) {
+        if (n > byte_buffer_avail(b)) {
+            return -ENOMEM;
+        }
+        b->used += n;
+        return value;
+    }
+
     const ssize_t rc = byte_buffer_add(b, data, n);
     if (rc < 0) {
         value = rc;
@@ -63,6 +73,20 @@ write_to_buffer(void *driver, const void *data, size_t n)
     return value;
 }
 
+static ssize_t
+reserve_in_buffer(void *driver, void **mem, size_t min, size_t max)
+{
+    ByteBuffer *b = driver;
+    const size_t avail = byte_buffer_avail(b);
+
+    if (avail < min) {
+        return -ENOMEM;
+    }
+
+    *mem = byte_buffer_writeptr(b);
+    return (ssize_t)(avail < max ? avail : max);
+}
+
 void
 source_from_buffer(Source *instance, ByteBuffer *buffer)
 {
@@ -79,4 +103,5 @@ void
 sink_to_buffer(Sink *instance, ByteBuffer *buffer)
 {
     chunk_sink_init(instance, write_to_buffer, buffer);
+    instance->ext.reserve = reserve_in_buffer;
 }
@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+/**
+ * @addtogroup endpoints Endpoints
+ * @{
+ *
+ * @file buffered.c
+ * @brief Implementation for buffered endpoints
+ *
+ * @}
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <ufw/compat/errno.h>
+#include <ufw/compat/ssize-t.h>
+
+#include <ufw/byte-buffer.h>
+#include <ufw/endpoints.h>
+#include <ufw/endpoints/buffered.h>
+
+/**
+ * Refill the read-ahead buffer of a buffered source
+ *
+ * This must only be called with an exhausted buffer. It issues exactly one
+ * source_read() on the wrapped source, asking for as much data as the buffer
+ * can hold.
+ *
+ * @param  bs  Pointer to the buffered source driver to refill
+ *
+ * @return Negative errno on failure; the number of octets read otherwise.
+ * @sideeffects Reads from the wrapped source and modifies the buffer.
+ */
+static ssize_t
+bs_refill(BufferedSource *bs)
+{
+    ByteBuffer *b = bs->buffer;
+    byte_buffer_reset(b);
+    const ssize_t rc = source_read(bs->source, b->data, b->size);
+    if (rc > 0) {
+        b->used = (size_t)rc;
+    }
+    return rc;
+}
+
+static ssize_t
+run_buffered_source(void *driver, void *buf, size_t n)
+{
+    BufferedSource *bs = driver;
+    ByteBuffer *b = bs->buffer;
+
+    if (byte_buffer_rest(b) == 0U) {
+        /* Requests that would fill the whole buffer anyway go straight to
+         * the wrapped source. This keeps large transfers from being copied
+         * twice. */
+        if (n >= b->size) {
+            byte_buffer_reset(b);
+            return source_read(bs->source, buf, n);
+        }
+        const ssize_t rc = bs_refill(bs);
+        if (rc <= 0) {
+            return rc;
+        }
+    }
+
+    const size_t rest = byte_buffer_rest(b);
+    const size_t m = n < rest ? n : rest;
+    unsigned char *src = byte_buffer_readptr(b);
+    /* With the getbuffer extension, sts_*() hand our own buffer back to us,
+     * in which case there is nothing to copy. */
+    if (src != buf) {
+        memcpy(buf, src, m);
+    }
+    b->offset += m;
+    return (ssize_t)m;
+}
+
+/**
+ * Implementation of the getbuffer extension for buffered sources
+ *
+ * If the source has data pending, this returns a view of that data. Reading
+ * from the source into that memory is recognised and does not copy anything.
+ * Otherwise the whole buffer is offered as scratch memory, which the source
+ * then reads into directly.
+ *
+ * @param  source  Pointer to the buffered source instance
+ *
+ * @return ByteBuffer describing the memory sts_*() should read into.
+ * @sideeffects None
+ */
+static ByteBuffer
+buffered_source_getbuffer(Source *source)
+{
+    BufferedSource *bs = source->driver;
+    ByteBuffer *b = bs->buffer;
+    if (byte_buffer_rest(b) > 0U) {
+        return *b;
+    }
+    ByteBuffer rv = BYTE_BUFFER(b->data, b->size);
+    return rv;
+}
+
+/**
+ * Initialise a buffered source
+ *
+ * The read-ahead buffer referenced by the driver is reset, so any data in it
+ * will be discarded. The wrapped source must be initialised before reading
+ * from the buffered source.
+ *
+ * @param  instance  Pointer to the Source instance to initialise
+ * @param  driver    Pointer to the buffered source driver to use
+ *
+ * @sideeffects Modifies the instance pointer and resets the driver's buffer.
+ */
+void
+buffered_source_init(Source *instance, BufferedSource *driver)
+{
+    byte_buffer_reset(driver->buffer);
+    chunk_source_init(instance, run_buffered_source, driver);
+    instance->ext.getbuffer = buffered_source_getbuffer;
+    instance->ext.seek = NULL;
+}
+
+/**
+ * Return the amount of data that was read ahead, but not consumed yet
+ *
+ * @param  driver  Pointer to the buffered source driver to query
+ *
+ * @return Number of octets pending in the read-ahead buffer.
+ * @sideeffects None
+ */
+size_t
+buffered_source_pending(const BufferedSource *driver)
+{
+    return byte_buffer_rest(driver->buffer);
+}
+
+/**
+ * Pass all data held in a buffered sink on to the wrapped sink
+ *
+ * If the wrapped sink fails, the data it did accept is removed from the
+ * buffer, and the rest remains for a later attempt. A sink that accepts
+ * nothing at all is treated like a failing sink, instead of trying again
+ * forever.
+ *
+ * @param  bs  Pointer to the buffered sink driver to flush
+ *
+ * @return Negative errno on failure; -EAGAIN if the wrapped sink made no
+ *         progress; zero on success.
+ * @sideeffects Writes to the wrapped sink and modifies the buffer.
+ */
+static int
+bs_flush(BufferedSink *bs)
+{
+    ByteBuffer *b = bs->buffer;
+    while (byte_buffer_rest(b) > 0U) {
+        const ssize_t rc = sink_put_chunk_atmost(
+            bs->sink, byte_buffer_readptr(b), byte_buffer_rest(b));
+        if (rc < 0) {
+            return (int)rc;
+        }
+        if (rc == 0) {
+            return -EAGAIN;
+        }
+        b->offset += rc;
+    }
+    byte_buffer_reset(b);
+    return 0;
+}
+
+static ssize_t
+run_buffered_sink(void *driver, const void *buf, size_t n)
+{
+    BufferedSink *bs = driver;
+    ByteBuffer *b = bs->buffer;
+
+    if (bs->error < 0) {
+        const int rc = bs->error;
+        bs->error = 0;
+        return rc;
+    }
+
+    /* With the getbuffer extension, data was put into our buffer already.
+     * All that is left to do is to account for it. */
+    if (buf == byte_buffer_writeptr(b)) {
+        const size_t avail = byte_buffer_avail(b);
+        const size_t m = n < avail ? n : avail;
+        b->used += m;
+        /* A full buffer would offer no space to the next getbuffer call, so
+         * pass it on right away. If that fails, the data is queued anyway.
+         * Returning the error now would make callers put it again, so it is
+         * returned by the next put or flush instead. */
+        if (byte_buffer_avail(b) == 0U) {
+            const int rc = bs_flush(bs);
+            if (rc < 0) {
+                bs->error = rc;
+            }
+        }
+        return (ssize_t)m;
+    }
+
+    if (n > byte_buffer_avail(b)) {
+        const int rc = bs_flush(bs);
+        if (rc < 0) {
+            return rc;
+        }
+        /* Data, that would fill the whole buffer anyway, is passed on
+         * directly, instead of copying it around first. */
+        if (n >= b->size) {
+            return sink_put_chunk(bs->sink, buf, n);
+        }
+    }
+
+    memcpy(byte_buffer_writeptr(b), buf, n);
+    b->used += n;
+    return (ssize_t)n;
+}
+
+static int
+run_buffered_sink_flush(void *driver, const EndpointFlushReason reason)
+{
+    BufferedSink *bs = driver;
+    if (reason == EP_FLUSH_END_OF_FRAME
+        && BIT_ISSET(bs->flags, BUFFERED_SINK_FLUSH_ON_FRAME) == false)
+    {
+        return 0;
+    }
+
+    if (bs->error < 0) {
+        const int rc = bs->error;
+        bs->error = 0;
+        return rc;
+    }
+
+    const int rc = bs_flush(bs);
+    if (rc < 0) {
+        return rc;
+    }
+
+    return sink_flush(bs->sink);
+}
+
+/**
+ * Implementation of the getbuffer extension for buffered sinks
+ *
+ * This offers the free space in the sink's buffer. Data put into that memory
+ * has to be committed by writing it to the sink, which is recognised and does
+ * not copy anything.
+ *
+ * @param  sink  Pointer to the buffered sink instance
+ *
+ * @return ByteBuffer describing the memory sts_*() should write into.
+ * @sideeffects None
+ */
+static ByteBuffer
+buffered_sink_getbuffer(Sink *sink)
+{
+    BufferedSink *bs = sink->driver;
+    ByteBuffer *b = bs->buffer;
+    ByteBuffer rv = BYTE_BUFFER_INIT(b->data, b->size, b->size, b->used);
+    return rv;
+}
+
+/**
+ * Implementation of the reserve extension for buffered sinks
+ *
+ * If the free space in the buffer is too small, the buffer is flushed first.
+ * Committing the reserved memory is recognised by run_buffered_sink().
+ *
+ * @param  driver  Pointer to the buffered sink driver
+ * @param  mem     Pointer used to return the reserved memory
+ * @param  min     Minimum amount of memory to reserve
+ * @param  max     Maximum amount of memory to reserve
+ *
+ * @return Negative errno on failure; the amount of memory reserved otherwise.
+ * @sideeffects May write to the wrapped sink.
+ */
+static ssize_t
+run_buffered_sink_reserve(void *driver, void **mem, size_t min, size_t max)
+{
+    BufferedSink *bs = driver;
+    ByteBuffer *b = bs->buffer;
+
+    if (b->size < min) {
+        return -ENOMEM;
+    }
+
+    if (byte_buffer_avail(b) < min) {
+        const int rc = bs_flush(bs);
+        if (rc < 0) {
+            return rc;
+        }
+    }
+
+    const size_t avail = byte_buffer_avail(b);
+    *mem = byte_buffer_writeptr(b);
+    return (ssize_t)(avail < max ? avail : max);
+}
+
+/**
+ * Initialise a buffered sink
+ *
+ * The buffer referenced by the driver is reset, so any data in it will be
+ * discarded. The wrapped sink must be initialised before writing to the
+ * buffered sink.
+ *
+ * @param  instance  Pointer to the Sink instance to initialise
+ * @param  driver    Pointer to the buffered sink driver to use
+ *
+ * @sideeffects Modifies the instance pointer and resets the driver's buffer.
+ */
+void
+buffered_sink_init(Sink *instance, BufferedSink *driver)
+{
+    byte_buffer_reset(driver->buffer);
+    driver->error = 0;
+    chunk_sink_init(instance, run_buffered_sink, driver);
+    instance->ext.getbuffer = buffered_sink_getbuffer;
+    instance->ext.seek = NULL;
+    instance->ext.flush = run_buffered_sink_flush;
+    instance->ext.reserve = run_buffered_sink_reserve;
+}
+
+/**
+ * Return the amount of data that is held back by a buffered sink
+ *
+ * @param  driver  Pointer to the buffered sink driver to query
+ *
+ * @return Number of octets that were not passed on to the wrapped sink yet.
+ * @sideeffects None
+ */
+size_t
+buffered_sink_pending(const BufferedSink *driver)
+{
+    return byte_buffer_rest(driver->buffer);
+}
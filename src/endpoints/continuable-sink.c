@@ -26,12 +26,48 @@ cs_add(ContinuableSink *cs, const void *data, const size_t n)
     if (b == NULL) {
         return -ENOMEM;
     }
-    const size_t rest = byte_buffer_rest(b);
-    const size_t tosave = n < rest ? n : rest;
-    byte_buffer_add(b, data, tosave);
+    const size_t avail = byte_buffer_avail(b);
+    const size_t tosave = n < avail ? n : avail;
+    if (cs->chksum != NULL && b == &cs->buffer) {
+        /* Copy and checksum in one go. With data produced in place via
+         * run_continuable_reserve(), source and destination are the same,
+         * and this only updates the checksum. */
+        if (tosave > 0U) {
+            cs->sum = cs->chksum(cs->sum, byte_buffer_writeptr(b),
+                                 data, tosave);
+            b->used += tosave;
+        }
+    } else if (data == byte_buffer_writeptr(b)) {
+        /* Produced in place via run_continuable_reserve() */
+        b->used += tosave;
+    } else {
+        byte_buffer_add(b, data, tosave);
+    }
     return tosave < n ? -ENOMEM : 0;
 }
 
+static ssize_t
+run_continuable_reserve(void *driver, void **mem, size_t min, size_t max)
+{
+    ContinuableSink *cs = driver;
+
+    /* Only hand out memory in normal operation, with a buffer in place. All
+     * other situations are dealt with by the write callback, which receives
+     * the data from the caller's scratch memory in that case. */
+    if (cs->error.id != 0 || cs->buffer.data == NULL) {
+        return -ENOMEM;
+    }
+
+    ByteBuffer *b = &cs->buffer;
+    const size_t avail = byte_buffer_avail(b);
+    if (avail < min) {
+        return -ENOMEM;
+    }
+
+    *mem = byte_buffer_writeptr(b);
+    return (ssize_t)(avail < max ? avail : max);
+}
+
 static ssize_t
 run_continuable_sink(void *driver, const void *data, size_t n)
 {
@@ -100,7 +136,9 @@ continuable_sink_init(Sink *instance, ContinuableSink *driver)
     driver->buffer.size = 0U;
     driver->buffer.offset = 0U;
     driver->buffer.used = 0U;
+    driver->sum = 0U;
     driver->error.id = 0U;
     driver->error.datacount = 0U;
     chunk_sink_init(instance, run_continuable_sink, driver);
+    instance->ext.reserve = run_continuable_reserve;
 }
@@ -79,6 +79,27 @@ chunk_source_init(Source *instance, ChunkSource source, void *driver)
     instance->ext.getbuffer = NULL;
 }
 
+/**
+ * Initialise a source of kind DATA_KIND_VECTOR
+ *
+ * @param  instance  Pointer to the Source instance to initialise
+ * @param  source    ChunksSource function that should drive the source
+ * @param  driver    Pointer to arbitrary data handed to the driver function
+ *
+ * @sideeffects Modifies the instance pointer
+ */
+void
+vector_source_init(Source *instance, ChunksSource source, void *driver)
+{
+    trace();
+    instance->kind = DATA_KIND_VECTOR;
+    instance->source.vector = source;
+    instance->driver = driver;
+    instance->retry.run = NULL;
+    instance->retry.init = NULL;
+    instance->ext.getbuffer = NULL;
+}
+
 /**
  * Initialise a sink of kind DATA_KIND_OCTET
  *
@@ -98,6 +119,8 @@ octet_sink_init(Sink *instance, ByteSink sink, void *driver)
     instance->retry.run = NULL;
     instance->retry.init = NULL;
     instance->ext.getbuffer = NULL;
+    instance->ext.flush = NULL;
+    instance->ext.reserve = NULL;
 }
 
 /**
@@ -119,6 +142,80 @@ chunk_sink_init(Sink *instance, ChunkSink sink, void *driver)
     instance->retry.run = NULL;
     instance->retry.init = NULL;
     instance->ext.getbuffer = NULL;
+    instance->ext.flush = NULL;
+    instance->ext.reserve = NULL;
+}
+
+/**
+ * Initialise a sink of kind DATA_KIND_VECTOR
+ *
+ * @param  instance  Pointer to the Sink instance to initialise
+ * @param  sink      ChunksSink function that should drive the sink
+ * @param  driver    Pointer to arbitrary data handed to the driver function
+ *
+ * @sideeffects Modifies the instance pointer
+ */
+void
+vector_sink_init(Sink *instance, ChunksSink sink, void *driver)
+{
+    trace();
+    instance->kind = DATA_KIND_VECTOR;
+    instance->sink.vector = sink;
+    instance->driver = driver;
+    instance->retry.run = NULL;
+    instance->retry.init = NULL;
+    instance->ext.getbuffer = NULL;
+    instance->ext.flush = NULL;
+    instance->ext.reserve = NULL;
+}
+
+/**
+ * Perform plain reads on a vector source
+ *
+ * This wraps the memory in question into a single chunk for the source.
+ *
+ * @param  source  ChunksSource function pointer to adapt
+ * @param  driver  Pointer to source driver data
+ * @param  buf     Pointer to memory to read into
+ * @param  n       Size of the memory pointed to by buf
+ *
+ * @return Negative values use -errno to encode errors; other values indicate
+ *         the amount of data that was read.
+ * @sideeffects The procedure moves data from the source to the supplied
+ *              memory.
+ */
+static inline ssize_t
+source_vector_adapt(ChunksSource source, void *driver,
+                    void *buf, const size_t n)
+{
+    trace();
+    ByteBuffer b = BYTE_BUFFER_EMPTY(buf, n);
+    const ByteChunks c = { .chunks = 1U, .active = 0U, .chunk = &b };
+    return source(driver, &c);
+}
+
+/**
+ * Perform plain writes on a vector sink
+ *
+ * This wraps the memory in question into a single chunk for the sink.
+ *
+ * @param  sink    ChunksSink function pointer to adapt
+ * @param  driver  Pointer to sink driver data
+ * @param  buf     Pointer to memory to write from
+ * @param  n       Size of the memory pointed to by buf
+ *
+ * @return Negative values use -errno to encode errors; other values indicate
+ *         the amount of data that was written.
+ * @sideeffects The procedure moves data from the supplied memory to the sink.
+ */
+static inline ssize_t
+sink_vector_adapt(ChunksSink sink, void *driver,
+                  const void *buf, const size_t n)
+{
+    trace();
+    ByteBuffer b = BYTE_BUFFER((void*)buf, n);
+    const ByteChunks c = { .chunks = 1U, .active = 0U, .chunk = &b };
+    return sink(driver, &c);
 }
 
 /**
@@ -141,9 +238,16 @@ int
 source_get_octet(Source *source, void *data)
 {
     trace();
-    return source->kind == DATA_KIND_OCTET
-        ? source->source.octet(source->driver, data)
-        : source->source.chunk(source->driver, data, 1U);
+    switch (source->kind) {
+    case DATA_KIND_OCTET:
+        return source->source.octet(source->driver, data);
+    case DATA_KIND_VECTOR:
+        return (int)source_vector_adapt(source->source.vector, source->driver,
+                                        data, 1U);
+    case DATA_KIND_CHUNK: /* FALLTHROUGH */
+    default:
+        return (int)source->source.chunk(source->driver, data, 1U);
+    }
 }
 
 /**
@@ -166,9 +270,16 @@ int
 sink_put_octet(Sink *sink, const unsigned char data)
 {
     trace();
-    return sink->kind == DATA_KIND_OCTET
-        ? sink->sink.octet(sink->driver, data)
-        : sink->sink.chunk(sink->driver, &data, 1U);
+    switch (sink->kind) {
+    case DATA_KIND_OCTET:
+        return sink->sink.octet(sink->driver, data);
+    case DATA_KIND_VECTOR:
+        return (int)sink_vector_adapt(sink->sink.vector, sink->driver,
+                                      &data, 1U);
+    case DATA_KIND_CHUNK: /* FALLTHROUGH */
+    default:
+        return (int)sink->sink.chunk(sink->driver, &data, 1U);
+    }
 }
 
 /**
@@ -288,9 +399,16 @@ ssize_t
 source_read(Source *source, void *buf, const size_t n)
 {
     trace();
-    return source->kind == DATA_KIND_OCTET
-        ? source_adapt(source->source.octet, source->driver, buf, n)
-        : source->source.chunk(source->driver, buf, n);
+    switch (source->kind) {
+    case DATA_KIND_OCTET:
+        return source_adapt(source->source.octet, source->driver, buf, n);
+    case DATA_KIND_VECTOR:
+        return source_vector_adapt(source->source.vector, source->driver,
+                                   buf, n);
+    case DATA_KIND_CHUNK: /* FALLTHROUGH */
+    default:
+        return source->source.chunk(source->driver, buf, n);
+    }
 }
 
 struct size_error {
@@ -471,9 +589,15 @@ ssize_t
 sink_write(Sink *sink, const void *buf, const size_t n)
 {
     trace();
-    return sink->kind == DATA_KIND_OCTET
-        ? sink_adapt(sink->sink.octet, sink->driver, buf, n)
-        : sink->sink.chunk(sink->driver, buf, n);
+    switch (sink->kind) {
+    case DATA_KIND_OCTET:
+        return sink_adapt(sink->sink.octet, sink->driver, buf, n);
+    case DATA_KIND_VECTOR:
+        return sink_vector_adapt(sink->sink.vector, sink->driver, buf, n);
+    case DATA_KIND_CHUNK: /* FALLTHROUGH */
+    default:
+        return sink->sink.chunk(sink->driver, buf, n);
+    }
 }
 
 /* Similar to source_read_multi(), this is the worker for sink_put_chunk() and
@@ -587,6 +711,228 @@ sink_put_chunk_atmost(Sink *sink, const void *buf, const size_t n)
     return (rc.size == 0) ? rc.error : (ssize_t)rc.size;
 }
 
+/**
+ * Decide whether to retry a vector transfer
+ *
+ * This mirrors the retry behaviour of source_read_multi() and
+ * sink_write_multi() for transfers into and out of ByteChunks.
+ *
+ * @param  retry  Pointer to the retry configuration of the endpoint
+ * @param  drv    Pointer to endpoint driver
+ * @param  get    Return code of the failed transfer
+ *
+ * @return A positive value to retry the transfer; otherwise the error code to
+ *         return to the caller.
+ * @sideeffects Those of the endpoint's retry configuration.
+ */
+static inline ssize_t
+vector_retry(struct ufw_ep_retry *retry, void *drv, const ssize_t get)
+{
+    trace();
+    if (retry->run == NULL) {
+        return (get == 0 || get == -EINTR || get == -EAGAIN) ? 1 : get;
+    }
+
+    const ssize_t retried = ep_retry(retry, drv, get);
+    return (retried == 0) ? -ENODATA : retried;
+}
+
+/**
+ * Read into a vector of chunks from a source without retry-logic
+ *
+ * This is similar to POSIX readv() for arbitrary Source instances. The free
+ * space of all chunks, starting at the active one, is offered to the source.
+ * Sources of kind DATA_KIND_VECTOR fill it in a single access. With other
+ * sources, the chunks are filled one after another, until one of them cannot
+ * be filled completely.
+ *
+ * The chunks' meta data is not modified. Use source_get_chunks() for the full
+ * endpoint functionality.
+ *
+ * @param  source  Pointer to the source to read from
+ * @param  chunks  Pointer to the chunks to read into
+ *
+ * @return Negative values use -errno to encode errors; other values indicate
+ *         the amount of data that was read.
+ * @sideeffects The procedure moves data from the source to the supplied
+ *              memory.
+ */
+ssize_t
+source_read_chunks(Source *source, const ByteChunks *chunks)
+{
+    trace();
+    if (source->kind == DATA_KIND_VECTOR) {
+        return source->source.vector(source->driver, chunks);
+    }
+
+    size_t done = 0U;
+    for (size_t i = chunks->active; i < chunks->chunks; ++i) {
+        ByteBuffer *b = chunks->chunk + i;
+        const size_t avail = byte_buffer_avail(b);
+        if (avail == 0U) {
+            continue;
+        }
+        const ssize_t rc = source_read(source, b->data + b->used, avail);
+        if (rc <= 0) {
+            return (done == 0U) ? rc : (ssize_t)done;
+        }
+        done += rc;
+        if ((size_t)rc < avail) {
+            break;
+        }
+    }
+
+    return (ssize_t)done;
+}
+
+/**
+ * Write a vector of chunks to a sink without retry-logic
+ *
+ * This is similar to POSIX writev() for arbitrary Sink instances. The unpro-
+ * cessed data of all chunks, starting at the active one, is offered to the
+ * sink. Sinks of kind DATA_KIND_VECTOR take it in a single access. With other
+ * sinks, the chunks are written one after another, until one of them cannot
+ * be written completely.
+ *
+ * The chunks' meta data is not modified. Use sink_put_chunks() for the full
+ * endpoint functionality.
+ *
+ * @param  sink    Pointer to sink instance to write to
+ * @param  chunks  Pointer to the chunks to write
+ *
+ * @return Negative values use -errno to encode errors; other values indicate
+ *         the amount of data that was written.
+ * @sideeffects The procedure moves data from the supplied memory to the sink.
+ */
+ssize_t
+sink_write_chunks(Sink *sink, const ByteChunks *chunks)
+{
+    trace();
+    if (sink->kind == DATA_KIND_VECTOR) {
+        return sink->sink.vector(sink->driver, chunks);
+    }
+
+    size_t done = 0U;
+    for (size_t i = chunks->active; i < chunks->chunks; ++i) {
+        ByteBuffer *b = chunks->chunk + i;
+        const size_t rest = byte_buffer_rest(b);
+        if (rest == 0U) {
+            continue;
+        }
+        const ssize_t rc = sink_write(sink, b->data + b->offset, rest);
+        if (rc <= 0) {
+            return (done == 0U) ? rc : (ssize_t)done;
+        }
+        done += rc;
+        if ((size_t)rc < rest) {
+            break;
+        }
+    }
+
+    return (ssize_t)done;
+}
+
+/**
+ * Fill a vector of chunks from a source
+ *
+ * This reads from a source until the free space of all chunks, starting with
+ * the active one, is filled. Like source_get_chunk(), this retries on common
+ * issues and honours the source's retry configuration.
+ *
+ * The chunks' used marks and the active chunk are moved forward with each
+ * successful read, so in case of an error they reflect the data that was read
+ * before the error occurred.
+ *
+ * @param  source  Pointer to the source to read from
+ * @param  chunks  Pointer to the chunks to read into
+ *
+ * @return Negative values use -errno to encode errors; other values indicate
+ *         the amount of data that was read.
+ * @sideeffects The procedure moves data from the source to the supplied
+ *              memory, and updates the chunks' meta data.
+ */
+ssize_t
+source_get_chunks(Source *source, ByteChunks *chunks)
+{
+    trace();
+    const size_t n = byte_chunks_avail(chunks);
+    if (n == 0 || n > SSIZE_MAX) {
+        return -EINVAL;
+    }
+
+    if (source->retry.init != NULL) {
+        source->retry.init(&source->retry);
+    }
+
+    size_t done = 0U;
+    while (done < n) {
+        const ssize_t get = source_read_chunks(source, chunks);
+        if (get <= 0) {
+            const ssize_t rc = vector_retry(&source->retry,
+                                            source->driver, get);
+            if (rc > 0) {
+                continue;
+            }
+            return rc;
+        }
+        done += byte_chunks_markwritten(chunks, get);
+    }
+
+    return (ssize_t)n;
+}
+
+/**
+ * Write a vector of chunks to a sink
+ *
+ * This writes to a sink until the unprocessed data of all chunks, starting
+ * with the active one, is transferred. Like sink_put_chunk(), this retries on
+ * common issues and honours the sink's retry configuration.
+ *
+ * The chunks' process marks and the active chunk are moved forward with each
+ * successful write, so in case of an error they reflect the data that was
+ * written before the error occurred.
+ *
+ * @param  sink    Pointer to sink instance to write to
+ * @param  chunks  Pointer to the chunks to write
+ *
+ * @return Negative values use -errno to encode errors; other values indicate
+ *         the amount of data that was written.
+ * @sideeffects The procedure moves data from the supplied memory to the sink,
+ *              and updates the chunks' meta data.
+ */
+ssize_t
+sink_put_chunks(Sink *sink, ByteChunks *chunks)
+{
+    trace();
+    const size_t n = byte_chunks_rest(chunks);
+    if (n == 0) {
+        return 0;
+    }
+
+    if (n > SSIZE_MAX) {
+        return -EINVAL;
+    }
+
+    if (sink->retry.init != NULL) {
+        sink->retry.init(&sink->retry);
+    }
+
+    size_t done = 0U;
+    while (done < n) {
+        const ssize_t get = sink_write_chunks(sink, chunks);
+        if (get <= 0) {
+            const ssize_t rc = vector_retry(&sink->retry, sink->driver, get);
+            if (rc > 0) {
+                continue;
+            }
+            return rc;
+        }
+        done += byte_chunks_markread(chunks, get);
+    }
+
+    return (ssize_t)n;
+}
+
 /**
  * Query is a source instance implements the getbuffer extension
  *
@@ -659,6 +1005,124 @@ sink_seek(Sink *sink, size_t offset)
     return sink->ext.seek(sink->driver, offset);
 }
 
+/**
+ * Ask a sink to pass on any data it is holding back
+ *
+ * Sinks, that do not hold back any data, do not need to implement this.
+ * Flushing such a sink is always successful.
+ *
+ * @param  sink  Pointer to the sink instance to flush
+ *
+ * @return Negative errno on failure; zero on success.
+ * @sideeffects Any sideeffects performed by the driver of the sink instance.
+ */
+int
+sink_flush(Sink *sink)
+{
+    trace();
+    if (sink->ext.flush == NULL) {
+        return 0;
+    }
+
+    return sink->ext.flush(sink->driver, EP_FLUSH_REQUEST);
+}
+
+/**
+ * Signal the end of a frame to a sink
+ *
+ * Framing protocols call this after they handed a complete frame to a sink.
+ * The sink may use this as a hint to pass on data it is holding back. This is
+ * not a guarantee, use sink_flush() for that.
+ *
+ * @param  sink  Pointer to the sink instance to signal
+ *
+ * @return Negative errno on failure; zero on success.
+ * @sideeffects Any sideeffects performed by the driver of the sink instance.
+ */
+int
+sink_end_of_frame(Sink *sink)
+{
+    trace();
+    if (sink->ext.flush == NULL) {
+        return 0;
+    }
+
+    return sink->ext.flush(sink->driver, EP_FLUSH_END_OF_FRAME);
+}
+
+/**
+ * Reserve memory to produce data into for a sink
+ *
+ * This allows producers, like encoders, to generate data directly into the
+ * memory of a sink, instead of generating it into memory of their own and then
+ * copying it into the sink. The memory is handed to the sink by calling
+ * sink_commit() with the amount of data that was actually produced. No other
+ * access to the sink is allowed between reserving and committing.
+ *
+ * If the sink does not implement the reserve extension, or it cannot offer
+ * the minimum amount of memory at this point, the scratch buffer is returned
+ * instead, if it is large enough. Committing then copies the scratch memory
+ * into the sink. That way producers can use this API without having to care
+ * about the kind of sink they are working with.
+ *
+ * @param  sink     Pointer to the sink instance to reserve memory in
+ * @param  scratch  Pointer to fallback memory; may be NULL
+ * @param  mem      Pointer used to return the reserved memory
+ * @param  min      Minimum amount of memory to reserve
+ * @param  max      Maximum amount of memory to reserve
+ *
+ * @return Negative errno on failure; the amount of memory reserved on
+ *         success. -ENOMEM signals that neither the sink, nor the scratch
+ *         buffer could offer at least "min" octets.
+ * @sideeffects Any sideeffects performed by the driver of the sink instance.
+ */
+ssize_t
+sink_reserve(Sink *sink, ByteBuffer *scratch, void **mem,
+             const size_t min, const size_t max)
+{
+    trace();
+    if (min == 0U || min > max || min > SSIZE_MAX) {
+        return -EINVAL;
+    }
+
+    const size_t limit = (max > SSIZE_MAX) ? SSIZE_MAX : max;
+    if (sink->ext.reserve != NULL) {
+        const ssize_t rc = sink->ext.reserve(sink->driver, mem, min, limit);
+        if (rc != -ENOMEM || scratch == NULL) {
+            return rc;
+        }
+    }
+
+    if (scratch == NULL || scratch->size < min) {
+        return -ENOMEM;
+    }
+
+    *mem = scratch->data;
+    return (ssize_t)((scratch->size < limit) ? scratch->size : limit);
+}
+
+/**
+ * Commit data produced into memory reserved by sink_reserve()
+ *
+ * Sinks that implement the reserve extension recognise their own memory and
+ * merely account for the data. Otherwise this copies the data into the sink,
+ * just like sink_put_chunk() does.
+ *
+ * @param  sink  Pointer to the sink instance to commit to
+ * @param  mem   Pointer to the memory returned by sink_reserve()
+ * @param  n     Amount of data produced into that memory
+ *
+ * @return Negative values use -errno to encode errors; other values indicate
+ *         the amount of data that was committed.
+ * @sideeffects The procedure moves data from the supplied memory to the sink.
+ */
+ssize_t
+sink_commit(Sink *sink, const void *mem, const size_t n)
+{
+    trace();
+    return sink_put_chunk(sink, mem, n);
+}
+
 /*
  * Plumbing API, Source-to-Sink (sts_)
  *
@@ -702,9 +1166,12 @@ sts_atmost_via_sink(Source *source, Sink *sink, const size_t n)
         return -ENOMEM;
     }
     const size_t m = (n == 0 || rest < n) ? rest : n;
-    return (source->kind == DATA_KIND_CHUNK)
-        ? source->source.chunk(source->driver, buf, m)
-        : source_get_chunk(source, buf, m);
+    const ssize_t rc = (source->kind == DATA_KIND_OCTET)
+        ? source_get_chunk(source, buf, m)
+        : source_read(source, buf, m);
+    /* Hand the data to the sink, to let it know how much of its buffer was
+     * filled. Sinks are expected to recognise their own memory here. */
+    return (rc <= 0) ? rc : sink_put_chunk(sink, buf, rc);
 }
 
 /**
@@ -738,9 +1205,9 @@ sts_atmost_via_source(Source *source, Sink *sink, const size_t n)
         return -ENODATA;
     }
     const size_t m = (n == 0 || rest < n) ? rest : n;
-    const ssize_t rc = (source->kind == DATA_KIND_CHUNK)
-        ? source->source.chunk(source->driver, buf, m)
-        : source_get_chunk(source, buf, m);
+    const ssize_t rc = (source->kind == DATA_KIND_OCTET)
+        ? source_get_chunk(source, buf, m)
+        : source_read(source, buf, m);
     return (rc < 0) ? rc : sink_put_chunk(sink, buf, rc);
 }
 
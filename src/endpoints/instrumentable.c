@@ -211,6 +211,103 @@ run_instrumentable_chunk_sink(void *driver, const void *data, size_t n)
     return rc < 0 ? rc : (ssize_t)n;
 }
 
+static ssize_t
+run_instrumentable_vector_source(void *driver, const ByteChunks *chunks)
+{
+    InstrumentableBuffer *b = driver;
+    const InstrumentableError *err = &b->read.error;
+    InstrumentableAccessStats *stat = &b->read.stat;
+
+    stat->accesses++;
+
+    if (BIT_ISSET(err->flags, INSTRUMENTABLE_UNTIL_SUCCESS)) {
+        if (stat->accesses <= err->at) {
+            return err->number;
+        }
+    }
+
+    if (BIT_ISSET(err->flags, INSTRUMENTABLE_UNTIL_FAILURE)) {
+        if (b->buffer.used >= err->at) {
+            return err->number;
+        }
+    }
+
+    /* The chunk size limits the amount of data per access, no matter how
+     * many chunks are involved. */
+    size_t done = 0U;
+    for (size_t i = chunks->active; i < chunks->chunks; ++i) {
+        ByteBuffer *c = chunks->chunk + i;
+        const size_t avail = byte_buffer_avail(c);
+        const size_t budget = b->chunksize - done;
+        const size_t n = avail < budget ? avail : budget;
+        if (n == 0U) {
+            if (budget == 0U) {
+                break;
+            }
+            continue;
+        }
+        const ssize_t rc =
+            byte_buffer_consume_at_most(&b->buffer, c->data + c->used, n);
+        if (rc < 0) {
+            return (done == 0U) ? rc : (ssize_t)done;
+        }
+        done += rc;
+        if ((size_t)rc < n) {
+            break;
+        }
+    }
+
+    return (ssize_t)done;
+}
+
+static ssize_t
+run_instrumentable_vector_sink(void *driver, const ByteChunks *chunks)
+{
+    InstrumentableBuffer *b = driver;
+    const InstrumentableError *err = &b->write.error;
+    InstrumentableAccessStats *stat = &b->write.stat;
+
+    stat->accesses++;
+
+    if (BIT_ISSET(err->flags, INSTRUMENTABLE_UNTIL_SUCCESS)) {
+        if (stat->accesses <= err->at) {
+            return err->number;
+        }
+    }
+
+    if (BIT_ISSET(err->flags, INSTRUMENTABLE_UNTIL_FAILURE)) {
+        if (b->buffer.used >= err->at) {
+            return err->number;
+        }
+    }
+
+    size_t done = 0U;
+    for (size_t i = chunks->active; i < chunks->chunks; ++i) {
+        const ByteBuffer *c = chunks->chunk + i;
+        const size_t rest = byte_buffer_rest(c);
+        const size_t budget = b->chunksize - done;
+        const size_t n = rest < budget ? rest : budget;
+        if (n == 0U) {
+            if (budget == 0U) {
+                break;
+            }
+            continue;
+        }
+        if (BIT_ISSET(b->flags, INSTRUMENTABLE_COMMON_ENABLE_TRACE)) {
+            for (size_t j = 0U; j < n; ++j) {
+                debug_trace(true, driver, c->data[c->offset + j]);
+            }
+        }
+        const int rc = byte_buffer_add(&b->buffer, c->data + c->offset, n);
+        if (rc < 0) {
+            return (done == 0U) ? rc : (ssize_t)done;
+        }
+        done += n;
+    }
+
+    return (ssize_t)done;
+}
+
 void
 instrumentable_source(const DataKind kind,
                       Source *instance,
@@ -224,6 +321,9 @@ instrumentable_source(const DataKind kind,
     case DATA_KIND_CHUNK:
         chunk_source_init(instance, run_instrumentable_chunk_source, buffer);
         break;
+    case DATA_KIND_VECTOR:
+        vector_source_init(instance, run_instrumentable_vector_source, buffer);
+        break;
     default:
         assert(false);
         break;
@@ -243,6 +343,9 @@ instrumentable_sink(const DataKind kind,
     case DATA_KIND_CHUNK:
         chunk_sink_init(instance, run_instrumentable_chunk_sink, buffer);
         break;
+    case DATA_KIND_VECTOR:
+        vector_sink_init(instance, run_instrumentable_vector_sink, buffer);
+        break;
     default:
         assert(false);
         break;
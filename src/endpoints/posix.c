@@ -14,11 +14,17 @@
  * @}
  */
 
+#include <stdbool.h>
+#include <stddef.h>
+
 #include <ufw/toolchain.h>
 
 #ifdef WITH_UNISTD_H
 #include <unistd.h>
 #endif /* WITH_UNISTD_H */
+#ifdef WITH_SYS_UIO_H
+#include <sys/uio.h>
+#endif /* WITH_SYS_UIO_H */
 
 #include <ufw/compat/errno.h>
 #include <ufw/compat/ssize-t.h>
@@ -57,3 +63,73 @@ sink_to_filedesc(Sink *instance, int *fd)
     chunk_sink_init(instance, run_write, fd);
 }
 #endif /* UFW_HAVE_POSIX_WRITE */
+
+#if defined(UFW_HAVE_POSIX_READV) || defined(UFW_HAVE_POSIX_WRITEV)
+/* Maximum number of chunks handed to a single readv() or writev() call. Any
+ * chunks beyond that are left to later calls, which is fine since both calls
+ * may transfer less data than offered anyway. POSIX guarantees IOV_MAX to be
+ * at least 16. */
+#define POSIX_IOV_CHUNKS 16U
+
+static int
+chunks_to_iovec(const ByteChunks *chunks, struct iovec *iov, const bool rd)
+{
+    int n = 0;
+    for (size_t i = chunks->active; i < chunks->chunks; ++i) {
+        ByteBuffer *b = chunks->chunk + i;
+        const size_t len = rd ? byte_buffer_avail(b) : byte_buffer_rest(b);
+        if (len == 0U) {
+            continue;
+        }
+        iov[n].iov_base = rd ? b->data + b->used : b->data + b->offset;
+        iov[n].iov_len = len;
+        if (++n == (int)POSIX_IOV_CHUNKS) {
+            break;
+        }
+    }
+    return n;
+}
+#endif /* UFW_HAVE_POSIX_READV || UFW_HAVE_POSIX_WRITEV */
+
+#ifdef UFW_HAVE_POSIX_READV
+ssize_t
+run_readv(void *driver, const ByteChunks *chunks)
+{
+    int *fd = driver;
+    struct iovec iov[POSIX_IOV_CHUNKS];
+    const int n = chunks_to_iovec(chunks, iov, true);
+    if (n == 0) {
+        return -EINVAL;
+    }
+    const ssize_t rc = readv(*fd, iov, n);
+    return (rc == 0) ? -ENODATA
+        : ((rc < 0) ? -errno : rc);
+}
+
+void
+source_from_filedesc_vector(Source *instance, int *fd)
+{
+    vector_source_init(instance, run_readv, fd);
+}
+#endif /* UFW_HAVE_POSIX_READV */
+
+#ifdef UFW_HAVE_POSIX_WRITEV
+ssize_t
+run_writev(void *driver, const ByteChunks *chunks)
+{
+    int *fd = driver;
+    struct iovec iov[POSIX_IOV_CHUNKS];
+    const int n = chunks_to_iovec(chunks, iov, false);
+    if (n == 0) {
+        return 0;
+    }
+    const ssize_t rc = writev(*fd, iov, n);
+    return (rc < 0) ? -errno : rc;
+}
+
+void
+sink_to_filedesc_vector(Sink *instance, int *fd)
+{
+    vector_sink_init(instance, run_writev, fd);
+}
+#endif /* UFW_HAVE_POSIX_WRITEV */
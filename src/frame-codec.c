@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+/**
+ * @addtogroup framecodec Frame Codecs
+ * @{
+ *
+ * @file frame-codec.c
+ * @brief Common interface to framing protocols
+ *
+ * @}
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ufw/compat/errno.h>
+#include <ufw/compat/ssize-t.h>
+
+#include <ufw/byte-buffer.h>
+#include <ufw/cobs.h>
+#include <ufw/compiler.h>
+#include <ufw/endpoints.h>
+#include <ufw/frame-codec.h>
+#include <ufw/length-prefix.h>
+#include <ufw/rfc1055.h>
+#include <ufw/variable-length-integer.h>
+
+/*
+ * SLIP
+ */
+
+static void
+codec_slip_init(const FrameCodec *codec, FrameCodecState *state)
+{
+    rfc1055_context_init(&state->slip, codec->param);
+}
+
+static int
+codec_slip_encode_chunks(const FrameCodec *codec, ByteChunks *chunks,
+                         Sink *sink)
+{
+    RFC1055Context ctx;
+    Source source;
+    rfc1055_context_init(&ctx, codec->param);
+    source_from_chunks(&source, chunks);
+    return rfc1055_encode(&ctx, &source, sink);
+}
+
+static int
+codec_slip_decode_into(UNUSED const FrameCodec *codec,
+                       FrameCodecState *state, Source *source, Sink *sink)
+{
+    const int rc = rfc1055_decode(&state->slip, source, sink);
+    return (rc < 0) ? rc : 0;
+}
+
+static size_t
+codec_slip_max_overhead(const FrameCodec *codec, const size_t n)
+{
+    return RFC1055_WORST_CASE(n, BIT_ISSET(codec->param, RFC1055_WITH_SOF))
+        - n;
+}
+
+static ssize_t
+codec_slip_feed(UNUSED const FrameCodec *codec, FrameCodecState *state,
+                const void *in, const size_t n, ByteBuffer *frame,
+                FrameCallback cb, void *arg)
+{
+    return rfc1055_decode_feed(&state->slip, in, n, frame, cb, arg);
+}
+
+#define SLIP_CODEC(NAME,FLAGS)                     \
+    { .name = (NAME),                              \
+      .param = (FLAGS),                            \
+      .init = codec_slip_init,                     \
+      .encode_chunks = codec_slip_encode_chunks,   \
+      .decode_into = codec_slip_decode_into,       \
+      .max_overhead = codec_slip_max_overhead,     \
+      .feed = codec_slip_feed }
+
+const FrameCodec frame_codec_slip =
+    SLIP_CODEC("slip", RFC1055_DEFAULT);
+const FrameCodec frame_codec_slip_with_sof =
+    SLIP_CODEC("slip-with-sof", RFC1055_WITH_SOF);
+
+/*
+ * COBS
+ */
+
+static void
+codec_cobs_init(UNUSED const FrameCodec *codec, FrameCodecState *state)
+{
+    cobs_context_init(&state->cobs);
+}
+
+static int
+codec_cobs_encode_chunks(UNUSED const FrameCodec *codec, ByteChunks *chunks,
+                         Sink *sink)
+{
+    /* Single chunk frames can use the bulk encoder. */
+    if (chunks->chunks - chunks->active == 1U) {
+        ByteBuffer *b = chunks->chunk + chunks->active;
+        return cobs_encode_buffer(byte_buffer_readptr(b),
+                                  byte_buffer_rest(b), sink);
+    }
+
+    Source source;
+    source_from_chunks(&source, chunks);
+    return cobs_encode(&source, sink);
+}
+
+static int
+codec_cobs_decode_into(UNUSED const FrameCodec *codec,
+                       FrameCodecState *state, Source *source, Sink *sink)
+{
+    const int rc = cobs_decode(&state->cobs, source, sink);
+    return (rc < 0) ? rc : 0;
+}
+
+static size_t
+codec_cobs_max_overhead(UNUSED const FrameCodec *codec, const size_t n)
+{
+    return COBS_WORST_CASE(n) - n;
+}
+
+static ssize_t
+codec_cobs_feed(UNUSED const FrameCodec *codec, FrameCodecState *state,
+                const void *in, const size_t n, ByteBuffer *frame,
+                FrameCallback cb, void *arg)
+{
+    return cobs_decode_feed(&state->cobs, in, n, frame, cb, arg);
+}
+
+const FrameCodec frame_codec_cobs = {
+    .name = "cobs",
+    .param = 0U,
+    .init = codec_cobs_init,
+    .encode_chunks = codec_cobs_encode_chunks,
+    .decode_into = codec_cobs_decode_into,
+    .max_overhead = codec_cobs_max_overhead,
+    .feed = codec_cobs_feed };
+
+/*
+ * Length Prefix Framing
+ */
+
+static void
+codec_lenp_init(const FrameCodec *codec, FrameCodecState *state)
+{
+    flenp_context_init(&state->lenp, (LengthPrefixKind)codec->param);
+}
+
+static int
+codec_lenp_encode_chunks(const FrameCodec *codec, ByteChunks *chunks,
+                         Sink *sink)
+{
+    const ssize_t rc = flenp_chunks_to_sink((LengthPrefixKind)codec->param,
+                                            sink, chunks);
+    return (rc < 0) ? (int)rc : 0;
+}
+
+static int
+codec_lenp_decode_into(const FrameCodec *codec,
+                       UNUSED FrameCodecState *state,
+                       Source *source, Sink *sink)
+{
+    const ssize_t rc = flenp_decode_source_to_sink(
+        (LengthPrefixKind)codec->param, source, sink);
+    return (rc < 0) ? (int)rc : 0;
+}
+
+static size_t
+codec_lenp_max_overhead(const FrameCodec *codec, const size_t n)
+{
+    switch ((LengthPrefixKind)codec->param) {
+    case LENP_OCTET:    return 1U;
+    case LENP_LE_16BIT: /* FALLTHROUGH */
+    case LENP_BE_16BIT: return 2U;
+    case LENP_LE_32BIT: /* FALLTHROUGH */
+    case LENP_BE_32BIT: return 4U;
+    case LENP_VARIABLE: /* FALLTHROUGH */
+    default:            return varint_u64_length(n);
+    }
+}
+
+static ssize_t
+codec_lenp_feed(UNUSED const FrameCodec *codec, FrameCodecState *state,
+                const void *in, const size_t n, ByteBuffer *frame,
+                FrameCallback cb, void *arg)
+{
+    return flenp_decode_feed(&state->lenp, in, n, frame, cb, arg);
+}
+
+#define LENP_CODEC(NAME,KIND)                      \
+    { .name = (NAME),                              \
+      .param = (KIND),                             \
+      .init = codec_lenp_init,                     \
+      .encode_chunks = codec_lenp_encode_chunks,   \
+      .decode_into = codec_lenp_decode_into,       \
+      .max_overhead = codec_lenp_max_overhead,     \
+      .feed = codec_lenp_feed }
+
+const FrameCodec frame_codec_lenp_variable =
+    LENP_CODEC("lenp-variable", LENP_VARIABLE);
+const FrameCodec frame_codec_lenp_octet =
+    LENP_CODEC("lenp-octet", LENP_OCTET);
+const FrameCodec frame_codec_lenp_le16 =
+    LENP_CODEC("lenp-le16", LENP_LE_16BIT);
+const FrameCodec frame_codec_lenp_le32 =
+    LENP_CODEC("lenp-le32", LENP_LE_32BIT);
+const FrameCodec frame_codec_lenp_be16 =
+    LENP_CODEC("lenp-be16", LENP_BE_16BIT);
+const FrameCodec frame_codec_lenp_be32 =
+    LENP_CODEC("lenp-be32", LENP_BE_32BIT);
+
+static const FrameCodec *lenp_codec[] = {
+    [LENP_VARIABLE] = &frame_codec_lenp_variable,
+    [LENP_OCTET]    = &frame_codec_lenp_octet,
+    [LENP_LE_16BIT] = &frame_codec_lenp_le16,
+    [LENP_LE_32BIT] = &frame_codec_lenp_le32,
+    [LENP_BE_16BIT] = &frame_codec_lenp_be16,
+    [LENP_BE_32BIT] = &frame_codec_lenp_be32
+};
+
+/**
+ * Return the codec for a kind of length prefix framing
+ *
+ * @param  k  Kind of length prefix framing
+ *
+ * @return Pointer to the codec; NULL for unknown kinds.
+ * @sideeffects None
+ */
+const FrameCodec *
+frame_codec_lenp(const LengthPrefixKind k)
+{
+    if ((size_t)k >= sizeof(lenp_codec) / sizeof(*lenp_codec)) {
+        return NULL;
+    }
+    return lenp_codec[k];
+}
@@ -16,6 +16,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <ufw/compat/errno.h>
 #include <ufw/compat/ssize-t.h>
@@ -26,6 +27,11 @@
 #include <ufw/length-prefix.h>
 #include <ufw/variable-length-integer.h>
 
+/* Maximum number of payload chunks, flenp_chunks_to_sink() hands to a sink
+ * along with the length prefix in a single vector write. Frames with more
+ * chunks than that are written chunk by chunk. */
+#define LENP_VECTOR_CHUNKS 7U
+
 typedef unsigned char (*octet_parse)(const void*);
 typedef void* (*octet_generate)(void*, const unsigned char);
 
@@ -206,6 +212,13 @@ flenp_memory_to_sink(const LengthPrefixKind k, Sink *sink, void *buf, size_t n)
         }
     }
 
+    {
+        const int rcsink = sink_end_of_frame(sink);
+        if (rcsink < 0) {
+            return (ssize_t)rcsink;
+        }
+    }
+
     return (ssize_t)(numlen + n);
 }
 
@@ -229,6 +242,47 @@ flenp_buffer_to_sink_n(const LengthPrefixKind k,
     return rc;
 }
 
+/**
+ * Assemble a length prefixed frame in memory reserved in a sink
+ *
+ * This only works with sinks, that can offer the whole frame in one piece of
+ * memory via sink_reserve(). No scratch memory is used, so -ENOMEM signals
+ * that the caller has to fall back to writing the frame piece by piece.
+ *
+ * @param  sink    Pointer to the sink to write the frame to
+ * @param  prefix  Pointer to the encoded length prefix
+ * @param  numlen  Size of the encoded length prefix
+ * @param  oc      Pointer to the frame's payload chunks
+ * @param  size    Size of the frame's payload
+ *
+ * @return Negative errno on failure; zero on success.
+ * @sideeffects Writes the frame to the sink.
+ */
+static int
+lenp_chunks_reserved(Sink *sink, const unsigned char *prefix,
+                     const size_t numlen, const ByteChunks *oc,
+                     const size_t size)
+{
+    void *mem;
+    const ssize_t rc = sink_reserve(sink, NULL, &mem,
+                                    numlen + size, numlen + size);
+    if (rc < 0) {
+        return (int)rc;
+    }
+
+    unsigned char *dst = mem;
+    memcpy(dst, prefix, numlen);
+    dst += numlen;
+    for (size_t i = oc->active; i < oc->chunks; ++i) {
+        const size_t n = byte_buffer_rest(oc->chunk + i);
+        memcpy(dst, oc->chunk[i].data + oc->chunk[i].offset, n);
+        dst += n;
+    }
+
+    const ssize_t rcsink = sink_commit(sink, mem, numlen + size);
+    return (rcsink < 0) ? (int)rcsink : 0;
+}
+
 ssize_t
 flenp_chunks_to_sink(const LengthPrefixKind k, Sink *sink, ByteChunks *oc)
 {
@@ -254,21 +308,58 @@ flenp_chunks_to_sink(const LengthPrefixKind k, Sink *sink, ByteChunks *oc)
     }
 #endif
 
-    {
-        const int rcsink = sink_put_chunk(sink, lpb.prefix_, numlen);
+    const int rcres = (sink->ext.reserve == NULL)
+        ? -ENOMEM
+        : lenp_chunks_reserved(sink, lpb.prefix_, numlen, oc, size);
+
+    if (rcres != -ENOMEM) {
+        /* Either the frame was assembled in the sink's own memory, or
+         * doing that failed for reasons other than lack of memory. */
+        if (rcres < 0) {
+            return rcres;
+        }
+    } else if ((oc->chunks - oc->active) <= LENP_VECTOR_CHUNKS) {
+        /* Hand prefix and payload to the sink in one go. With vector sinks,
+         * that is a single access. Copying the payload's ByteBuffer meta data
+         * leaves the caller's chunks untouched. */
+        ByteBuffer prefix = BYTE_BUFFER(lpb.prefix_, numlen);
+        ByteBuffer v[LENP_VECTOR_CHUNKS + 1U];
+        v[0] = prefix;
+        for (size_t i = oc->active; i < oc->chunks; ++i) {
+            v[1U + i - oc->active] = oc->chunk[i];
+        }
+        ByteChunks vc = {
+            .chunks = 1U + oc->chunks - oc->active,
+            .active = 0U,
+            .chunk = v };
+        const ssize_t rcsink = sink_put_chunks(sink, &vc);
         if (rcsink < 0) {
-            return (ssize_t)rcsink;
+            return rcsink;
+        }
+    } else {
+        {
+            const int rcsink = sink_put_chunk(sink, lpb.prefix_, numlen);
+            if (rcsink < 0) {
+                return (ssize_t)rcsink;
+            }
+        }
+
+        for (size_t i = oc->active; i < oc->chunks; ++i) {
+            const size_t n = byte_buffer_rest(oc->chunk + i);
+            const ssize_t rcsink = sink_put_chunk(
+                sink, oc->chunk[i].data + oc->chunk[i].offset, n);
+            if (rcsink < 0) {
+                return rcsink;
+            } else if (rcsink == 0) {
+                return 0;
+            }
         }
     }
 
-    for (size_t i = oc->active; i < oc->chunks; ++i) {
-        const size_t n = byte_buffer_rest(oc->chunk + i);
-        const ssize_t rcsink = sink_put_chunk(
-            sink, oc->chunk[i].data + oc->chunk[i].offset, n);
+    {
+        const int rcsink = sink_end_of_frame(sink);
         if (rcsink < 0) {
-            return rcsink;
-        } else if (rcsink == 0) {
-            return 0;
+            return (ssize_t)rcsink;
         }
     }
 
@@ -347,3 +438,177 @@ flenp_decode_source_to_sink(const LengthPrefixKind k,
 
     return sts_n(source, sink, len);
 }
+
+void
+flenp_context_init(LengthPrefixContext *ctx, const LengthPrefixKind k)
+{
+    ctx->kind = k;
+    ctx->state = LENP_READ_PREFIX;
+    ctx->prefix = 0U;
+    ctx->rest = 0U;
+}
+
+/**
+ * Hand a frame to the user of flenp_decode_feed()
+ *
+ * @param  ctx     Pointer to the length prefix context in use
+ * @param  frame   Pointer to the frame buffer
+ * @param  status  Status code of the frame
+ * @param  cb      Frame callback to call
+ * @param  arg     Argument for the callback
+ *
+ * @return Return value of the callback.
+ * @sideeffects Modifies ctx, calls cb and resets the frame buffer.
+ */
+static inline int
+lenp_deliver(LengthPrefixContext *ctx, ByteBuffer *frame, const int status,
+             LengthPrefixFrameCallback cb, void *arg)
+{
+    ctx->state = LENP_READ_PREFIX;
+    ctx->prefix = 0U;
+    const int rc = cb(arg, frame, status);
+    byte_buffer_reset(frame);
+    return rc;
+}
+
+/**
+ * Add an octet to the length prefix being collected
+ *
+ * @param  ctx    Pointer to the length prefix context in use
+ * @param  octet  Octet to add
+ * @param  len    Pointer used to return the decoded length
+ *
+ * @return -EILSEQ if the prefix is an overlong variable-length integer; one
+ *         if the prefix is complete; zero otherwise.
+ * @sideeffects Modifies ctx.
+ */
+static int
+lenp_prefix_octet(LengthPrefixContext *ctx, const unsigned char octet,
+                  uint64_t *len)
+{
+    const LengthPrefixKind k = ctx->kind;
+    ctx->prefix_[ctx->prefix++] = octet;
+
+    if (k == LENP_VARIABLE) {
+        if ((octet & VARINT_CONTINUATION_MASK) != 0U) {
+            return (ctx->prefix < VARINT_64BIT_MAX_OCTETS) ? 0 : -EILSEQ;
+        }
+        ByteBuffer b = BYTE_BUFFER(ctx->prefix_, ctx->prefix);
+        return (varint_decode_u64(&b, len) < 0) ? -EILSEQ : 1;
+    }
+
+    if (ctx->prefix < kind[k].size) {
+        return 0;
+    }
+
+    switch (kind[k].size) {
+    case 1:  *len = kind[k].cb.u8.parse( ctx->prefix_); break;
+    case 2:  *len = kind[k].cb.u16.parse(ctx->prefix_); break;
+    default: *len = kind[k].cb.u32.parse(ctx->prefix_); break;
+    }
+    return 1;
+}
+
+/**
+ * Decode a chunk of length prefixed data
+ *
+ * This is the length prefix counterpart of rfc1055_decode_feed(): Data is
+ * handed to the decoder as it arrives, in pieces of arbitrary size, and all
+ * state needed to continue with the next piece, including a partially
+ * received prefix, is kept in the context. Payload is copied to the frame
+ * buffer in one go. Complete frames are handed to the callback, after which
+ * the frame buffer is reset.
+ *
+ * A frame that does not fit into the frame buffer is delivered with -ENOBUFS,
+ * and its payload is dropped. Since length prefixed streams carry no means to
+ * resynchronise, an invalid variable-length integer prefix is delivered with
+ * -EILSEQ, and decoding simply continues with the next octet.
+ *
+ * The frame buffer may share memory with the input, as long as the input does
+ * not start before the frame buffer's write pointer.
+ *
+ * @param  ctx    Pointer to the length prefix context to use
+ * @param  in     Pointer to encoded data
+ * @param  n      Size of the encoded data
+ * @param  frame  Pointer to the buffer to decode frames into
+ * @param  cb     Callback to hand frames to
+ * @param  arg    Argument handed to the callback
+ *
+ * @return Negative value returned by the callback, which stops decoding
+ *         after the frame in question; the amount of data consumed (n)
+ *         otherwise.
+ * @sideeffects Modifies ctx and frame; calls cb.
+ */
+ssize_t
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+flenp_decode_feed(LengthPrefixContext *ctx, const void *in, const size_t n,
+                  ByteBuffer *frame, LengthPrefixFrameCallback cb, void *arg)
+{
+    if (n > SSIZE_MAX) {
+        return -EINVAL;
+    }
+
+    const unsigned char *p = in;
+    size_t rest = n;
+
+    while (rest > 0U) {
+        switch (ctx->state) {
+        case LENP_READ_PAYLOAD: {
+            const size_t m = (ctx->rest < rest) ? (size_t)ctx->rest : rest;
+            unsigned char *dst = byte_buffer_writeptr(frame);
+            if (dst != p) {
+                memmove(dst, p, m);
+            }
+            frame->used += m;
+            p += m;
+            rest -= m;
+            ctx->rest -= m;
+            if (ctx->rest == 0U) {
+                const int rc = lenp_deliver(ctx, frame, 0, cb, arg);
+                if (rc < 0) {
+                    return rc;
+                }
+            }
+            break;
+        }
+        case LENP_SKIP_PAYLOAD: {
+            const size_t m = (ctx->rest < rest) ? (size_t)ctx->rest : rest;
+            p += m;
+            rest -= m;
+            ctx->rest -= m;
+            if (ctx->rest == 0U) {
+                ctx->state = LENP_READ_PREFIX;
+            }
+            break;
+        }
+        case LENP_READ_PREFIX: /* FALLTHROUGH */
+        default: {
+            uint64_t len = 0U;
+            const int done = lenp_prefix_octet(ctx, *p++, &len);
+            rest--;
+            int rc = 0;
+            if (done < 0) {
+                rc = lenp_deliver(ctx, frame, done, cb, arg);
+            } else if (done == 0) {
+                break;
+            } else if (len == 0U) {
+                rc = lenp_deliver(ctx, frame, 0, cb, arg);
+            } else if (len > byte_buffer_avail(frame)) {
+                rc = lenp_deliver(ctx, frame, -ENOBUFS, cb, arg);
+                ctx->state = LENP_SKIP_PAYLOAD;
+                ctx->rest = len;
+            } else {
+                ctx->prefix = 0U;
+                ctx->state = LENP_READ_PAYLOAD;
+                ctx->rest = len;
+            }
+            if (rc < 0) {
+                return rc;
+            }
+            break;
+        }
+        }
+    }
+
+    return (ssize_t)n;
+}
@@ -128,6 +128,7 @@ persistent_sum16(PersistentStorage *store, PersistentChksum16 f, uint16_t init)
     store->checksum.type = PERSISTENT_CHECKSUM_16BIT;
     store->checksum.size = checksum_size(store);
     store->checksum.process.c16 = f;
+    store->checksum.zeros.z16 = NULL;
     set_data_address(store);
 }
 
@@ -147,9 +148,58 @@ persistent_sum32(PersistentStorage *store, PersistentChksum32 f, uint32_t init)
     store->checksum.type = PERSISTENT_CHECKSUM_32BIT;
     store->checksum.size = checksum_size(store);
     store->checksum.process.c32 = f;
+    store->checksum.zeros.z32 = NULL;
     set_data_address(store);
 }
 
+/**
+ * Enable incremental checksum updates for 16-bit checksums
+ *
+ * By default, storing part of the data portion of an instance re-reads the
+ * whole data portion from the medium, to recalculate its checksum. With CRCs,
+ * it is possible to update the stored checksum using the previous and the new
+ * contents of the changed part only. To do that, a function that extends a
+ * checksum by a number of zero octets is required. For CRC-16-ARC, that is
+ * ufw_crc16_arc_zeros().
+ *
+ * The function must match the checksum algorithm configured with
+ * persistent_sum16(), which has to be called before this function, because it
+ * disables incremental updates.
+ *
+ * Note that with incremental updates, the stored checksum is updated rather
+ * than recalculated. So if the data portion was corrupted before a partial
+ * store, it will still fail to validate afterwards.
+ *
+ * @param  store   Pointer to the instance to configure
+ * @param  z       Function to extend the checksum by zero octets, or NULL to
+ *                 disable incremental updates
+ *
+ * @sideeffects store is mutated as advertised
+ */
+void
+persistent_sum16_zeros(PersistentStorage *store, PersistentChksumZeros16 z)
+{
+    store->checksum.zeros.z16 = z;
+}
+
+/**
+ * Enable incremental checksum updates for 32-bit checksums
+ *
+ * This is like persistent_sum16_zeros(), but for checksums configured with
+ * persistent_sum32().
+ *
+ * @param  store   Pointer to the instance to configure
+ * @param  z       Function to extend the checksum by zero octets, or NULL to
+ *                 disable incremental updates
+ *
+ * @sideeffects store is mutated as advertised
+ */
+void
+persistent_sum32_zeros(PersistentStorage *store, PersistentChksumZeros32 z)
+{
+    store->checksum.zeros.z32 = z;
+}
+
 /**
  * Initialise PersistentStorage instance
  *
@@ -185,47 +235,85 @@ persistent_init(PersistentStorage *store,
     store->buffer.data = NULL;
 }
 
+/* Size of the pieces persistent_put() writes while checksumming */
+#define PERSISTENT_STORE_CHUNK 256U
+
 /**
- * Run checksum algorithm if a storage instance for a memory block
+ * Write a memory block to the medium, optionally checksumming it on the way
  *
- * This takes a memory block, provided as ‘src’ and runs the checksum
- * algorithm, configured in the storage instance (type, data-size,
- * initial-value) for that piece of memory.
+ * With a checksum to update, data is written in pieces of
+ * PERSISTENT_STORE_CHUNK words, each of which is run through the configured
+ * checksum algorithm right after writing it, while it is still in the cache.
+ * That way, the data is only fetched from memory once.
  *
- * The memory block must be fit for this kind of access (i.e. be readable to
- * the configured size).
+ * @param  store    Pointer to the storage instance
+ * @param  address  Address in the medium to write to
+ * @param  src      Pointer to the memory block to write
+ * @param  n        Size of the memory block
+ * @param  sum      Pointer to the checksum to update; may be NULL
+ *
+ * @return PERSISTENT_ACCESS_SUCCESS or PERSISTENT_ACCESS_IO_ERROR.
+ * @sideeffects Writes to the medium; modifies *sum.
+ */
+static PersistentAccess
+persistent_put(PersistentStorage *store, uint32_t address,
+               const unsigned char *src, size_t n, PersistentChecksum *sum)
+{
+    if (sum == NULL) {
+        const size_t stored = store->block.write(address, src, n);
+        return (stored == n) ? PERSISTENT_ACCESS_SUCCESS
+                             : PERSISTENT_ACCESS_IO_ERROR;
+    }
+
+    while (n > 0U) {
+        const size_t k = (n > PERSISTENT_STORE_CHUNK)
+            ? PERSISTENT_STORE_CHUNK : n;
+        if (store->block.write(address, src, k) != k) {
+            return PERSISTENT_ACCESS_IO_ERROR;
+        }
+        switch (store->checksum.type) {
+        case PERSISTENT_CHECKSUM_16BIT:
+            sum->sum16 = store->checksum.process.c16(src, k, sum->sum16);
+            break;
+        case PERSISTENT_CHECKSUM_32BIT: /* FALLTHROUGH */
+        default:
+            sum->sum32 = store->checksum.process.c32(src, k, sum->sum32);
+            break;
+        }
+        src += k;
+        address += k;
+        n -= k;
+    }
+
+    return PERSISTENT_ACCESS_SUCCESS;
+}
+
+/**
+ * Extend a checksum by a number of zero words
  *
- * This is a simplified variant of persistent_calculate_checksum(), that relies
- * on the fact that the whole data to be checksummed can be accessed
- * consecutively. The caller has to make sure that is the case. If this cannot
- * be guaranteed, the more complex, but also more general function needs to be
- * used instead.
+ * The storage instance has to be configured for incremental updates.
  *
  * @param  store  Pointer to the storage instance
- * @param  src    Pointer to the memory block to process
+ * @param  sum    Checksum to extend
+ * @param  n      Number of zero words to extend the checksum by
  *
- * @return Checksum for the memory block according to the storage instance
+ * @return Extended checksum.
  * @sideeffects None
  */
 static PersistentChecksum
-persistent_checksum(const PersistentStorage *store, const void *src)
+persistent_zeros(const PersistentStorage *store, PersistentChecksum sum,
+                 size_t n)
 {
-    const unsigned char *from = src;
-    PersistentChecksum rv;
-
     switch (store->checksum.type) {
     case PERSISTENT_CHECKSUM_16BIT:
-        rv.sum16 = store->checksum.process.c16(
-            from, store->data.size, store->checksum.initial.sum16);
+        sum.sum16 = store->checksum.zeros.z16(sum.sum16, n);
         break;
     case PERSISTENT_CHECKSUM_32BIT: /* FALLTHROUGH */
     default:
-        rv.sum32 = store->checksum.process.c32(
-            from, store->data.size, store->checksum.initial.sum32);
+        sum.sum32 = store->checksum.zeros.z32(sum.sum32, n);
         break;
     }
-
-    return rv;
+    return sum;
 }
 
 /**
@@ -429,6 +517,109 @@ persistent_match(const PersistentStorage *store,
     }
 }
 
+/**
+ * Check if a storage instance can update its checksum incrementally
+ *
+ * @param  store  Pointer to the instance to query
+ *
+ * @return True if a zero extension function is configured; false otherwise.
+ * @sideeffects None
+ */
+static inline bool
+persistent_incremental(const PersistentStorage *store)
+{
+    switch (store->checksum.type) {
+    case PERSISTENT_CHECKSUM_16BIT:
+        return store->checksum.zeros.z16 != NULL;
+    case PERSISTENT_CHECKSUM_32BIT: /* FALLTHROUGH */
+    default:
+        return store->checksum.zeros.z32 != NULL;
+    }
+}
+
+/**
+ * Calculate checksum after replacing part of the data portion
+ *
+ * This must be called before the new data is written to the medium, because
+ * it reads the previous content of the part that is going to be replaced. For
+ * data of equal length, the difference of two CRCs is the CRC (with zero as
+ * its initial value) of the difference of the data. Since only the replaced
+ * part differs, that is the CRC of the previous and the new content of that
+ * part, extended by the number of octets that follow it.
+ *
+ * That is linear, so the contributions of previous and new content can be
+ * applied separately. This applies the previous content to the stored
+ * checksum. The new content is checksummed while it is written, and then
+ * applied the same way (see persistent_store_part()).
+ *
+ * @param  store   Pointer to the storage instance to process
+ * @param  offset  Offset of the part inside of the data portion
+ * @param  n       Size of the part
+ *
+ * @return Success code and partially updated checksum; or an error code.
+ * @sideeffects Accesses configured media as described.
+ */
+static struct maybe_sum
+persistent_delta_checksum(PersistentStorage *store, size_t offset, size_t n)
+{
+    struct maybe_sum rv = persistent_fetch_checksum(store);
+    if (rv.access != PERSISTENT_ACCESS_SUCCESS) {
+        return rv;
+    }
+    rv.access = PERSISTENT_ACCESS_IO_ERROR;
+
+    unsigned char buf;
+    unsigned char *data;
+    size_t bsize;
+
+    if (store->buffer.data != NULL) {
+        data = store->buffer.data;
+        bsize = store->buffer.size;
+    } else {
+        data = &buf;
+        bsize = 1U;
+    }
+
+    const bool c16 = (store->checksum.type == PERSISTENT_CHECKSUM_16BIT);
+    PersistentChecksum prev;
+    if (c16) {
+        prev.sum16 = 0U;
+    } else {
+        prev.sum32 = 0U;
+    }
+    size_t rest = n;
+    uint32_t address = store->data.address + offset;
+
+    while (rest > 0U) {
+        const size_t toget = (rest > bsize) ? bsize : rest;
+        const size_t got = store->block.read(data, address, toget);
+
+        if (got != toget) {
+            return rv;
+        }
+
+        if (c16) {
+            prev.sum16 = store->checksum.process.c16(data, toget, prev.sum16);
+        } else {
+            prev.sum32 = store->checksum.process.c32(data, toget, prev.sum32);
+        }
+
+        rest -= toget;
+        address += toget;
+    }
+
+    const size_t following = store->data.size - offset - n;
+    prev = persistent_zeros(store, prev, following);
+    if (c16) {
+        rv.value.sum16 ^= prev.sum16;
+    } else {
+        rv.value.sum32 ^= prev.sum32;
+    }
+
+    rv.access = PERSISTENT_ACCESS_SUCCESS;
+    return rv;
+}
+
 /**
  * Validate the a PersistentStorage instance
  *
@@ -497,6 +688,13 @@ persistent_fetch(void *dst, PersistentStorage *store)
 /**
  * Store part of the data portion into PersistentStorage instance
  *
+ * Afterwards, the checksum of the data portion has to be updated. When the
+ * whole data portion is stored, its checksum is computed while writing it.
+ * Otherwise, by default, this re-reads the whole data portion from the
+ * medium. If incremental updates are enabled via persistent_sum16_zeros() or
+ * persistent_sum32_zeros(), only the previous content of the replaced part is
+ * read instead.
+ *
  * @param  store   Pointer to PersistentStorage instance to use
  * @param  src     Pointer to source buffer to read from
  * @param  offset  Offset to start storing to inside of data portion
@@ -513,16 +711,46 @@ persistent_store_part(PersistentStorage *store, const void *src,
         return PERSISTENT_ACCESS_ADDRESS_OUT_OF_RANGE;
     }
 
-    const uint32_t address = store->data.address + offset;
-    const size_t stored = store->block.write(address, src, n);
-    if (stored != n) {
-        return PERSISTENT_ACCESS_IO_ERROR;
+    const bool whole = (offset == 0) && (n == store->data.size);
+    const bool incremental = (whole == false) && persistent_incremental(store);
+
+    /* The incremental update needs the previous content of the part that is
+     * replaced, so it has to run before writing. */
+    struct maybe_sum delta;
+    if (incremental) {
+        delta = persistent_delta_checksum(store, offset, n);
+        if (delta.access != PERSISTENT_ACCESS_SUCCESS) {
+            return delta.access;
+        }
     }
 
+    /* The new data is checksummed while it is written. For the whole data
+     * portion, that is the new checksum; for a part, it is its contribution
+     * to the incremental update. */
     PersistentChecksum sum;
-    if ((offset == 0) && (n == store->data.size)) {
-        sum = persistent_checksum(store, src);
+    if (whole) {
+        sum = store->checksum.initial;
+    } else if (store->checksum.type == PERSISTENT_CHECKSUM_16BIT) {
+        sum.sum16 = 0U;
     } else {
+        sum.sum32 = 0U;
+    }
+
+    const uint32_t address = store->data.address + offset;
+    const PersistentAccess rc = persistent_put(
+        store, address, src, n, (whole || incremental) ? &sum : NULL);
+    if (rc != PERSISTENT_ACCESS_SUCCESS) {
+        return rc;
+    }
+
+    if (incremental) {
+        sum = persistent_zeros(store, sum, store->data.size - offset - n);
+        if (store->checksum.type == PERSISTENT_CHECKSUM_16BIT) {
+            sum.sum16 ^= delta.value.sum16;
+        } else {
+            sum.sum32 ^= delta.value.sum32;
+        }
+    } else if (whole == false) {
         struct maybe_sum tmp = persistent_calculate_checksum(store);
         if (tmp.access != PERSISTENT_ACCESS_SUCCESS) {
             return tmp.access;
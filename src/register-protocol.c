@@ -15,6 +15,8 @@
  */
 
 #include <assert.h>
+#include <limits.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -25,9 +27,8 @@
 #include <ufw/crc/crc16-arc.h>
 #include <ufw/endpoints.h>
 #include <ufw/endpoints/continuable-sink.h>
-#include <ufw/length-prefix.h>
+#include <ufw/frame-codec.h>
 #include <ufw/register-protocol.h>
-#include <ufw/rfc1055.h>
 
 #define RP_HEADER_SIZE_16      8u
 #define RP_HEADER_MIN_SIZE_16  6u
@@ -38,6 +39,14 @@
 #define RP_HEADER_SIZE        (RP_HEADER_SIZE_16     * sizeof(uint16_t))
 #define RP_HEADER_MIN_SIZE    (RP_HEADER_MIN_SIZE_16 * sizeof(uint16_t))
 
+/* With eight bit octets, receive sinks compute the CRC of incoming frames
+ * while storing them, see check_payload(). */
+#if (CHAR_BIT == 8u)
+#define RECV_CHKSUM ufw_crc16_arc_memcpy
+#else
+#define RECV_CHKSUM NULL
+#endif /* (CHAR_BIT == 8u) */
+
 #define MSEM_AUTO  0u
 #define MSEM_8BIT  1u
 #define MSEM_16BIT 2u
@@ -58,6 +67,12 @@ raw_with_plcrc(const uint16_t motv)
     return BIT_ISSET(motv, RP_OPT_WITH_PAYLOAD_CRC << 8U);
 }
 
+static inline bool
+ep_is_serial(const RegP *p)
+{
+    return p->ep.type == RP_EP_SERIAL || p->ep.type == RP_EP_SERIAL_COBS;
+}
+
 static inline uint16_t
 make_motv(const RegP *p, const unsigned int msem,
           const uint_least8_t meta,
@@ -69,10 +84,10 @@ make_motv(const RegP *p, const unsigned int msem,
               || msem == MSEM_16BIT)
              ? RP_OPT_WORD_SIZE_16
              : 0U)
-          | (p->ep.type == RP_EP_SERIAL
+          | (ep_is_serial(p)
              ? RP_OPT_WITH_HEADER_CRC
              : 0U)
-          | ((p->ep.type == RP_EP_SERIAL
+          | ((ep_is_serial(p)
               && n > 0
               && type != RP_FRAME_READ_REQUEST)
              ? RP_OPT_WITH_PAYLOAD_CRC
@@ -215,16 +230,29 @@ parse_header(RPFrame *frame, void *buf, size_t n)
     return (crc == frame->header.hdcrc) ? (int)offset : -EILSEQ;
 }
 
+/*
+ * The receive sink computes the CRC of the raw frame while storing it, if it
+ * can. Since CRC16_ARC_INITIAL is zero, the CRC of header H followed by
+ * payload P is zeros(crc(H), |P|) XOR crc(P). So the payload CRC can be
+ * derived from that, by only looking at the header again.
+ */
 static int
-check_payload(const RPFrame *f)
+check_payload(const RPFrame *f, const uint16_t *rawcrc)
 {
     if (regp_has_hdcrc(f) == false || f->payload.size == 0U) {
         return 0;
     }
 
     uint16_t crc = 0U;
-
-    if (BIT_ISSET(f->header.options, RP_OPT_WORD_SIZE_16)) {
+    const size_t plsize = BIT_ISSET(f->header.options, RP_OPT_WORD_SIZE_16)
+        ? f->header.blocksize * sizeof(uint16_t)
+        : f->header.blocksize;
+
+    if (rawcrc != NULL && plsize == f->payload.size) {
+        const size_t hs = f->raw.size - f->payload.size;
+        const uint16_t hdr = ufw_buffer_crc16_arc(f->raw.memory, hs);
+        crc = *rawcrc ^ ufw_crc16_arc_zeros(hdr, plsize);
+    } else if (BIT_ISSET(f->header.options, RP_OPT_WORD_SIZE_16)) {
         crc = ufw_buffer_crc16_arc_u16(f->payload.data, f->header.blocksize);
     } else {
 #ifdef WITH_UINT8_T
@@ -261,7 +289,7 @@ payload_plausible(RPFrame *f)
 }
 
 static int
-parse_frame(ByteBuffer *framebuf)
+parse_frame(ByteBuffer *framebuf, const uint16_t *rawcrc)
 {
     int rc;
 
@@ -285,7 +313,7 @@ parse_frame(ByteBuffer *framebuf)
         return rc;
     }
 
-    rc = check_payload(frame);
+    rc = check_payload(frame, rawcrc);
     if (rc < 0) {
         return rc;
     }
@@ -305,21 +333,12 @@ send_memory(RegP *p, void *hdr, size_t hs, void *pl, size_t ps)
         data.chunks = 1U;
     }
 
-    /* Apply the correct framing here. */
-    switch (p->ep.type) {
-    case RP_EP_TCP: {
-        const ssize_t rc = lenp_chunks_to_sink(&p->ep.sink, &data);
-        return (rc < 0) ? (int)rc : 0;
-    }
-    case RP_EP_SERIAL:
-        /* FALLTHROUGH */
-    default: {
-        RFC1055Context slip = RFC1055_CONTEXT_INIT_DEFAULT;
-        Source src;
-        source_from_chunks(&src, &data);
-        return rfc1055_encode(&slip, &src, &p->ep.sink);
-    }
-    }
+    const int rc = frame_codec_encode_chunks(p->ep.codec, &data,
+                                             &p->ep.sink);
+
+    /* With a buffered sink, this makes the whole frame leave at once. With
+     * other sinks, this does nothing. */
+    return (rc < 0) ? rc : sink_flush(&p->ep.sink);
 }
 
 static RPFrameType
@@ -503,6 +522,7 @@ regp_init(RegP *p)
     p->ep.type = RP_EP_TCP;
     p->ep.source = source_empty;
     p->ep.sink = sink_null;
+    regp_use_codec(p, &frame_codec_lenp_variable);
     p->alloc = &rp_default_allocator;
 }
 
@@ -524,12 +544,51 @@ regp_use_memory16(RegP *p, RPBlockRead16 read, RPBlockWrite16 write)
     p->memory.access.m16.write = write;
 }
 
+/**
+ * Connect a protocol instance to a data channel
+ *
+ * This also selects the framing mandated for the endpoint type: SLIP for
+ * RP_EP_SERIAL, COBS for RP_EP_SERIAL_COBS, and length prefixing with
+ * variable-length integers for RP_EP_TCP. Use regp_use_codec() afterwards
+ * to pick a different framing.
+ *
+ * @param  p       Pointer to the protocol instance
+ * @param  type    Type of the endpoint
+ * @param  source  Source to receive frames from
+ * @param  sink    Sink to send frames to
+ *
+ * @sideeffects Modifies the protocol instance; resets the decoder state.
+ */
 void
 regp_use_channel(RegP *p, RPEndpointType type, Source source, Sink sink)
 {
     p->ep.type = type;
     p->ep.source = source;
     p->ep.sink = sink;
+    switch (type) {
+    case RP_EP_SERIAL:      regp_use_codec(p, &frame_codec_slip);          break;
+    case RP_EP_SERIAL_COBS: regp_use_codec(p, &frame_codec_cobs);          break;
+    case RP_EP_TCP:         /* FALLTHROUGH */
+    default:                regp_use_codec(p, &frame_codec_lenp_variable); break;
+    }
+}
+
+/**
+ * Select the framing used with a protocol instance's data channel
+ *
+ * The endpoint type set by regp_use_channel() still determines the use of
+ * checksums. Only the framing is changed.
+ *
+ * @param  p      Pointer to the protocol instance
+ * @param  codec  Frame codec to use
+ *
+ * @sideeffects Modifies the protocol instance; resets the decoder state.
+ */
+void
+regp_use_codec(RegP *p, const FrameCodec *codec)
+{
+    p->ep.codec = codec;
+    frame_codec_init(codec, &p->ep.state);
 }
 
 void
@@ -722,6 +781,57 @@ regp_resp_meta(RegP *p,const uint_least8_t meta)
  * leaks.
  */
 
+static int
+recv_finish(RegP *p, RPMaybeFrame *mf, ContinuableSink *cs, ByteBuffer *fb)
+{
+    if (cs->error.id != 0) {
+        mf->error.id = cs->error.id;
+        mf->error.framesize = cs->error.datacount;
+    }
+
+    mf->frame = (RPFrame*)cs->buffer.data;
+
+    switch (cs->error.id) {
+    case 0:
+        /* No error indicated. Good! */
+        break;
+    case EBUSY:
+        /* Send EBUSY reply, based on fallback buffer */
+        return early_ebusy(p, fb);
+    case ENOMEM:
+        /* Send ERXOVERFLOW reply, based on fallback buffer */
+        byte_buffer_rewind(fb);
+        byte_buffer_add(fb, mf->frame->raw.memory, RP_HEADER_SIZE);
+        return early_erxoverflow(p, fb);
+    default:
+        /* Unexpected error. Really shouldn't happen. */
+        return -EINVAL;
+    }
+
+    if (mf->frame == NULL) {
+        /* Empty frame; nothing was ever written to the sink. */
+        mf->error.id = EBADMSG;
+        return regp_resp_meta(p, RP_META_EHEADERENC);
+    }
+
+    int rc = parse_frame(&cs->buffer, cs->chksum != NULL ? &cs->sum : NULL);
+
+    if (rc < 0) {
+        mf->error.id = -rc;
+    }
+
+    if (rc == -EBADMSG) {
+        return regp_resp_meta(p, RP_META_EHEADERENC);
+    }
+
+    if (rc == -EILSEQ) {
+        return regp_resp_meta(p, RP_META_EHEADERCRC);
+    }
+
+    /* Frame read, parsed and verified. Nice. */
+    return 0;
+}
+
 int
 regp_recv(RegP *p, RPMaybeFrame *mf)
 {
@@ -826,65 +936,82 @@ regp_recv(RegP *p, RPMaybeFrame *mf)
     Sink recv;
     ContinuableSink cs = CONTINUABLE_SINK(p->alloc, &fb, setup_buffer);
     continuable_sink_init(&recv, &cs);
+    cs.chksum = RECV_CHKSUM;
 
-    switch (p->ep.type) {
-    case RP_EP_TCP: {
-        const ssize_t rc = lenp_decode_source_to_sink(&p->ep.source, &recv);
-        if (rc < 0) {
-            return rc;
-       }
-    } break;
-    case RP_EP_SERIAL:
-        /* FALLTHROUGH */
-    default: {
-        RFC1055Context slip = RFC1055_CONTEXT_INIT_DEFAULT;
-        const int rc = rfc1055_decode(&slip, &p->ep.source, &recv);
-        if (rc < 0) {
-            return rc;
-        }
-    } break;
-    }
-
-    if (cs.error.id != 0) {
-        mf->error.id = cs.error.id;
-        mf->error.framesize = cs.error.datacount;
+    const int rc = frame_codec_decode_into(p->ep.codec, &p->ep.state,
+                                           &p->ep.source, &recv);
+    if (rc < 0) {
+        return rc;
     }
 
-    mf->frame = (RPFrame*)cs.buffer.data;
-
-    switch (cs.error.id) {
-    case 0:
-        /* No error indicated. Good! */
-        break;
-    case EBUSY:
-        /* Send EBUSY reply, based on fallback buffer */
-        return early_ebusy(p, &fb);
-    case ENOMEM:
-        /* Send ERXOVERFLOW reply, based on fallback buffer */
-        byte_buffer_rewind(&fb);
-        byte_buffer_add(&fb, mf->frame->raw.memory, RP_HEADER_SIZE);
-        return early_erxoverflow(p, &fb);
-    default:
-        /* Unexpected error. Really shouldn't happen. */
-        return -EINVAL;
-    }
+    return recv_finish(p, mf, &cs, &fb);
+}
 
-    int rc = parse_frame(&cs.buffer);
+/**
+ * Receive a frame that was extracted from its framing already
+ *
+ * This is an alternative to regp_recv(), for users that do not receive frames
+ * through the source hooked into the protocol instance. An example would be a
+ * server that extracts a whole burst of frames from a single read, using
+ * rfc1055_decode_frames(). Each frame can then be handed to this function and
+ * processed by regp_process(), just like frames returned by regp_recv().
+ *
+ * @param  p     Pointer to the protocol instance
+ * @param  mf    Pointer to the RPMaybeFrame to fill in
+ * @param  data  Pointer to the raw frame, without framing
+ * @param  n     Size of the raw frame
+ *
+ * @return Negative errno on failure; zero otherwise. See regp_recv().
+ * @sideeffects Allocates memory for the frame; may send error responses.
+ */
+int
+regp_recv_frame(RegP *p, RPMaybeFrame *mf, const void *data, const size_t n)
+{
+    mf->frame = NULL;
+    mf->error.id = 0;
+    mf->error.framesize = 0U;
+    uint16_t fallback[RP_HEADER_SIZE_16];
+    ByteBuffer fb = BYTE_BUFFER_EMPTY((void*)fallback, sizeof(fallback));
+    Sink recv;
+    ContinuableSink cs = CONTINUABLE_SINK(p->alloc, &fb, setup_buffer);
+    continuable_sink_init(&recv, &cs);
+    cs.chksum = RECV_CHKSUM;
 
+    const ssize_t rc = sink_put_chunk(&recv, data, n);
     if (rc < 0) {
-        mf->error.id = -rc;
-    }
-
-    if (rc == -EBADMSG) {
-        return regp_resp_meta(p, RP_META_EHEADERENC);
+        return (int)rc;
     }
 
-    if (rc == -EILSEQ) {
-        return regp_resp_meta(p, RP_META_EHEADERCRC);
-    }
+    return recv_finish(p, mf, &cs, &fb);
+}
 
-    /* Frame read, parsed and verified. Nice. */
-    return 0;
+/**
+ * Decode data received on a protocol instance's channel
+ *
+ * This is meant for users that receive data in pieces of arbitrary size, for
+ * example from non-blocking reads. Data is decoded by the instance's codec,
+ * using the decoder state kept in the instance, so partially received frames
+ * are picked up where they left off with the next call. Complete frames are
+ * handed to the callback, which would usually pass them on to
+ * regp_recv_frame().
+ *
+ * @param  p      Pointer to the protocol instance
+ * @param  data   Pointer to the received data
+ * @param  n      Size of the received data
+ * @param  frame  Pointer to the buffer to decode frames into
+ * @param  cb     Callback to hand frames to
+ * @param  arg    Argument handed to the callback
+ *
+ * @return Negative value returned by the callback; the amount of data
+ *         consumed (n) otherwise.
+ * @sideeffects Modifies the decoder state and frame; calls cb.
+ */
+ssize_t
+regp_feed(RegP *p, const void *data, const size_t n, ByteBuffer *frame,
+          FrameCallback cb, void *arg)
+{
+    return frame_codec_feed(p->ep.codec, &p->ep.state, data, n,
+                            frame, cb, arg);
 }
 
 int
@@ -75,21 +75,36 @@ static inline bool register_area_can_write(const RegisterArea *a);
 static inline bool register_area_is_writeable(const RegisterArea *a);
 static inline bool register_area_is_readable(const RegisterArea *a);
 static bool ra_addr_is_part_of(RegisterArea *a, RegisterAddress addr);
-static inline bool ra_reg_is_part_of(RegisterArea *a, RegisterEntry *e);
 static bool ra_reg_fits_into(RegisterArea *a, RegisterEntry *e);
-static AreaHandle ra_find_area_by_addr(RegisterTable *t, RegisterAddress addr);
+static AreaHandle ra_first_ending_after(
+    const RegisterTable *t, AreaHandle lo, AreaHandle hi, RegisterAddress addr);
+static AreaHandle ra_find_area_from(
+    RegisterTable *t, AreaHandle first, RegisterAddress addr);
+static inline AreaHandle ra_find_area_by_addr(
+    RegisterTable *t, RegisterAddress addr);
 static inline int ra_range_touches(
     RegisterArea *a, RegisterAddress addr, RegisterOffset n);
+static RegisterAtom *ra_staging(RegisterArea *a);
+static void ra_swap(RegisterArea *a);
+static bool ra_publish(
+    RegisterTable *t, RegisterArea *a, RegisterHandle *first,
+    RegisterHandle *last);
 
 /* Entry utilities */
-static void reg_taint_in_range(
-    RegisterTable *t, RegisterAddress addr, RegisterOffset n);
+static RegisterHandle reg_first_ending_after(
+    const RegisterTable *t, RegisterHandle lo, RegisterHandle hi,
+    RegisterAddress addr);
 static bool reg_entry_is_in_memory(
-    RegisterTable *t, RegisterEntry *e);
+    RegisterTable *t, AreaHandle *an, RegisterEntry *e);
 static inline RegisterAccess reg_read_entry(
     RegisterEntry *e, RegisterAtom *buf);
+static inline RegisterAddress reg_entry_address(
+    const RegisterTable *t, RegisterHandle i);
+static inline RegisterAddress reg_entry_end(
+    const RegisterTable *t, RegisterHandle i);
 static inline int reg_range_touches(
-    RegisterEntry *e, RegisterAddress addr, RegisterOffset n);
+    const RegisterTable *t, RegisterHandle i, RegisterAddress addr,
+    RegisterOffset n);
 static RegisterAccess reg_entry_sane(
     RegisterTable *t, RegisterHandle reg);
 static RegisterAccess reg_entry_load_default(
@@ -97,12 +112,27 @@ static RegisterAccess reg_entry_load_default(
 static RegisterAccess register_setx(
     RegisterTable *t, RegisterHandle idx, RegisterValue v, bool);
 
-/* Block write utilities */
-static RegisterAccess ra_writeable(
+/* Notification utilities */
+static void reg_mark_dirty(RegisterTable *t, RegisterHandle reg);
+static void reg_range_changed(
     RegisterTable *t, RegisterAddress addr, RegisterOffset n);
-RegisterAccess ra_malformed_write(
-    RegisterTable *t, RegisterAddress addr, RegisterOffset n,
-    RegisterAtom *buf);
+static void reg_notify(
+    RegisterTable *t, RegisterHandle first, RegisterHandle last);
+static void reg_notify_range(
+    RegisterTable *t, RegisterHandle first, RegisterHandle last);
+static void reg_notify_handles(
+    RegisterTable *t, const RegisterHandle *h, size_t n);
+
+/* Block write utilities */
+static RegisterAccess reg_block_entry_valid(
+    RegisterTable *t, RegisterEntry *e, RegisterAddress addr,
+    RegisterOffset n, const RegisterAtom *buf);
+static RegisterAccess reg_block_validate(
+    RegisterTable *t, AreaHandle afirst, RegisterHandle efirst,
+    RegisterAddress addr, RegisterOffset n, const RegisterAtom *buf);
+static RegisterAccess reg_block_commit(
+    RegisterTable *t, AreaHandle afirst, RegisterHandle efirst,
+    RegisterAddress addr, RegisterOffset n, const RegisterAtom *buf);
 
 /* Iteration */
 
@@ -492,18 +522,40 @@ rv_validate(RegisterTable *t, RegisterEntry *e, const RegisterValue v)
     }
 }
 
+/*
+ * Address lookups use these to access the address and extent of an entry.
+ * If the table has a compact index, they read from its packed arrays, so
+ * scans do not pull the rest of each entry into the cache.
+ */
+static inline RegisterAddress
+reg_entry_address(const RegisterTable *t, RegisterHandle i)
+{
+    if (t->index.address != NULL) {
+        return t->index.address[i];
+    }
+    return t->entry[i].address;
+}
+
+static inline RegisterAddress
+reg_entry_end(const RegisterTable *t, RegisterHandle i)
+{
+    if (t->index.address != NULL) {
+        return t->index.address[i] + rds_size[t->index.type[i]];
+    }
+    return t->entry[i].address + rds_size[t->entry[i].type];
+}
+
 static inline int
-reg_range_touches(RegisterEntry *e, RegisterAddress addr, RegisterOffset n)
+reg_range_touches(const RegisterTable *t, RegisterHandle i,
+                  RegisterAddress addr, RegisterOffset n)
 {
     /* Return -1 if entry is below range; 0 if it is within the range and 1 if
      * it is above the range */
-    const RegisterOffset size = rds_size[e->type];
-
-    if ((e->address + size) <= addr) {
+    if (reg_entry_end(t, i) <= addr) {
         return -1;
     }
 
-    if ((addr + n) <= e->address) {
+    if ((addr + n) <= reg_entry_address(t, i)) {
         return 1;
     }
 
@@ -542,21 +594,6 @@ reg_entry_load_default(RegisterTable *t, RegisterHandle reg)
     return register_set(t, reg, def);
 }
 
-static void
-reg_taint_in_range(RegisterTable *t, RegisterAddress addr, RegisterOffset n)
-{
-    for (RegisterOffset i = 0UL; i < t->entries; ++i) {
-        int touch = reg_range_touches(&t->entry[i], addr, n);
-        if (touch > 0) {
-            return;
-        }
-        if (touch < 0) {
-            continue;
-        }
-        register_touch(t, i);
-    }
-}
-
 static AreaHandle
 reg_count_areas(RegisterArea *a)
 {
@@ -609,12 +646,6 @@ ra_addr_is_part_of(RegisterArea *a, RegisterAddress addr)
     return true;
 }
 
-static inline bool
-ra_reg_is_part_of(RegisterArea *a, RegisterEntry *e)
-{
-    return ra_addr_is_part_of(a, e->address);
-}
-
 static bool
 ra_reg_fits_into(RegisterArea *a, RegisterEntry *e)
 {
@@ -623,35 +654,94 @@ ra_reg_fits_into(RegisterArea *a, RegisterEntry *e)
     return (entry_end <= area_end);
 }
 
+/*
+ * register_init() makes sure, that areas and entries are sorted by address and
+ * do not overlap. That means that the end addresses of both lists are sorted
+ * as well, which allows bisecting them instead of scanning them from the
+ * start. These two return the first handle in [lo, hi) whose area or entry
+ * ends after addr; hi if there is no such handle.
+ */
 static AreaHandle
-ra_find_area_by_addr(RegisterTable *t, RegisterAddress addr)
+ra_first_ending_after(const RegisterTable *t, AreaHandle lo, AreaHandle hi,
+                      RegisterAddress addr)
+{
+    while (lo < hi) {
+        const AreaHandle mid = (AreaHandle)(lo + (hi - lo) / 2U);
+        const RegisterArea *a = &t->area[mid];
+        if ((a->base + a->size) <= addr) {
+            lo = (AreaHandle)(mid + 1U);
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+static RegisterHandle
+reg_first_ending_after(const RegisterTable *t, RegisterHandle lo,
+                       RegisterHandle hi, RegisterAddress addr)
 {
-    AreaHandle n;
-    for (n = 0ULL; n < t->areas; ++n) {
-        if (ra_addr_is_part_of(&t->area[n], addr)) {
-            break;
+    while (lo < hi) {
+        const RegisterHandle mid = lo + (hi - lo) / 2U;
+        if (reg_entry_end(t, mid) <= addr) {
+            lo = mid + 1U;
+        } else {
+            hi = mid;
         }
     }
 
-    return n;
+    return lo;
 }
 
-static bool
-reg_entry_is_in_memory(RegisterTable *t, RegisterEntry *e)
+static AreaHandle
+ra_find_area_from(RegisterTable *t, AreaHandle first, RegisterAddress addr)
 {
-    for (AreaHandle an = 0UL; an < t->areas; ++an) {
-        RegisterArea *area = &t->area[an];
-        if (ra_reg_is_part_of(area, e)) {
-            if (ra_reg_fits_into(area, e) == false) {
-                return false;
-            }
+    const AreaHandle n = ra_first_ending_after(t, first, t->areas, addr);
+    if (n < t->areas && ra_addr_is_part_of(&t->area[n], addr)) {
+        return n;
+    }
 
-            e->area = area;
-            e->offset = e->address - area->base;
-            return true;
+    return t->areas;
+}
+
+static inline AreaHandle
+ra_find_area_by_addr(RegisterTable *t, RegisterAddress addr)
+{
+    return ra_find_area_from(t, 0U, addr);
+}
+
+/*
+ * Entries are sorted by address, and so are areas. That means linking all
+ * entries to their areas in order is a single walk through both lists. ‘an’
+ * carries the area handle from one entry to the next.
+ */
+static bool
+reg_entry_is_in_memory(RegisterTable *t, AreaHandle *an, RegisterEntry *e)
+{
+    while (*an < t->areas) {
+        if (ra_range_touches(&t->area[*an], e->address, 1U) >= 0) {
+            break;
         }
+        (*an)++;
     }
-    return false;
+
+    if (*an == t->areas) {
+        return false;
+    }
+
+    RegisterArea *area = &t->area[*an];
+    if (ra_addr_is_part_of(area, e->address) == false) {
+        return false;
+    }
+
+    if (ra_reg_fits_into(area, e) == false) {
+        return false;
+    }
+
+    e->area = area;
+    e->offset = e->address - area->base;
+    return true;
 }
 
 static inline RegisterAccess
@@ -677,7 +767,7 @@ static RegisterHandle
 ra_first_entry_of_next(RegisterTable *t, RegisterArea *a, RegisterHandle start)
 {
     for (RegisterHandle i = start; i < t->entries; ++i) {
-        if (ra_addr_is_part_of(a, t->entry[i].address) == false) {
+        if (ra_addr_is_part_of(a, reg_entry_address(t, i)) == false) {
             return i;
         }
     }
@@ -685,10 +775,84 @@ ra_first_entry_of_next(RegisterTable *t, RegisterArea *a, RegisterHandle start)
 }
 
 static RegisterAccess
-ra_writeable(RegisterTable *t, RegisterAddress addr, RegisterOffset n)
+reg_block_entry_valid(RegisterTable *t, RegisterEntry *e, RegisterAddress addr,
+                      RegisterOffset n, const RegisterAtom *buf)
 {
     RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+    RegisterAtom raw[REG_SIZEOF_LARGEST_DATUM];
+    const RegisterOffset size = rds_size[e->type];
+    const RegisterAtom *src;
+    RegisterValue datum;
+
+    /* The first atom of the entry that the block touches. */
+    const RegisterAddress from = (addr > e->address) ? addr : e->address;
+
+    if (e->address >= addr && e->address + size <= addr + n) {
+        /* The block covers the entire entry, so its new binary form can be
+         * used straight from the block. */
+        src = buf + (e->address - addr);
+    } else {
+        /* The block only touches part of the entry. This can only happen
+         * with the first and the last entry the block touches: Fetch the old
+         * memory of the entry and overlay the part the block changes. */
+        const RegisterAddress to = reg_min(addr + n, e->address + size);
+        RegisterArea *a = e->area;
+        if (a->write == reg_mem_write
+            && BIT_ISSET(a->flags, REG_AF_DOUBLE_BUFFER))
+        {
+            /* The block is committed into the staging copy, which may hold
+             * changes that were not published yet. Merge against that. */
+            register_area_write_begin(a);
+            memcpy(raw, ra_staging(a) + e->offset,
+                   size * sizeof(RegisterAtom));
+            register_area_write_end(a);
+        } else {
+            rv = reg_read_entry(e, raw);
+            if (rv.code != REG_ACCESS_SUCCESS) {
+                return rv;
+            }
+        }
+        memcpy(raw + (from - e->address), buf + (from - addr),
+               (to - from) * sizeof(RegisterAtom));
+        src = raw;
+    }
+
+    /* Try the deserialiser, fail if it fails */
+    const bool bigendian = BIT_ISSET(t->flags, REG_TF_BIG_ENDIAN);
+    if (rds_serdes[e->type].des(src, &datum, bigendian) == false) {
+        rv.code = REG_ACCESS_INVALID;
+        rv.address = from;
+        return rv;
+    }
+
+    /* Try the validator, fail if it fails */
+    if (rv_validate(t, e, datum) == false) {
+        rv.code = REG_ACCESS_RANGE;
+        rv.address = from;
+        return rv;
+    }
+    return rv;
+}
+
+static RegisterAccess
+reg_block_validate(RegisterTable *t, AreaHandle afirst, RegisterHandle efirst,
+                   RegisterAddress addr, RegisterOffset n,
+                   const RegisterAtom *buf)
+{
+    RegisterAccess hole = REG_ACCESS_RESULT_INIT;
+    RegisterAccess malformed = REG_ACCESS_RESULT_INIT;
+    const RegisterAddress end = addr + n;
+    RegisterAddress cur = addr;
+    RegisterHandle en = efirst;
+
     /*
+     * Walk the areas the block touches and the entries within them once. The
+     * errors are reported in order of precedence: Writing to a read-only area
+     * is reported before writing into a hole in the address space, which in
+     * turn is reported before a malformed entry. Only an area that is read-
+     * only ends the walk early. Holes and entry errors are remembered, and
+     * once one was found, entries need not be looked at anymore.
+     *
      * There are two kinds of "writeability":
      *
      * - An area does not have the REG_AF_WRITEABLE bit set in its flags field.
@@ -699,123 +863,75 @@ ra_writeable(RegisterTable *t, RegisterAddress addr, RegisterOffset n)
      *   at all possible for the register abstraction to modify the range of
      *   memory in question.
      */
-    for (AreaHandle i = 0UL; i < t->areas; ++i) {
-        int touch = ra_range_touches(&t->area[i], addr, n);
-        if (touch < 0) {
-            continue;
-        }
-        if (touch > 0) {
+    for (AreaHandle an = afirst; an < t->areas; ++an) {
+        RegisterArea *a = &t->area[an];
+        if (a->base >= end) {
             break;
         }
-        if (register_area_is_writeable(&t->area[i]) == false) {
+
+        if (register_area_is_writeable(a) == false) {
+            RegisterAccess rv = REG_ACCESS_RESULT_INIT;
             rv.code = REG_ACCESS_READONLY;
             rv.address = addr;
             return rv;
         }
+
+        if (a->base > cur && hole.code == REG_ACCESS_SUCCESS) {
+            hole.code = REG_ACCESS_NOENTRY;
+            hole.address = cur;
+        }
+        cur = a->base + a->size;
+
+        while (hole.code == REG_ACCESS_SUCCESS
+               && malformed.code == REG_ACCESS_SUCCESS
+               && en < t->entries
+               && reg_entry_address(t, en) < reg_min(cur, end))
+        {
+            malformed = reg_block_entry_valid(t, &t->entry[en], addr, n, buf);
+            en++;
+        }
     }
 
-    return rv;
+    if (cur < end && hole.code == REG_ACCESS_SUCCESS) {
+        hole.code = REG_ACCESS_NOENTRY;
+        hole.address = cur;
+    }
+
+    return (hole.code != REG_ACCESS_SUCCESS) ? hole : malformed;
 }
 
-RegisterAccess
-ra_malformed_write(RegisterTable *t, RegisterAddress addr,
-                   RegisterOffset n, RegisterAtom *buf)
+static RegisterAccess
+reg_block_commit(RegisterTable *t, AreaHandle afirst, RegisterHandle efirst,
+                 RegisterAddress addr, RegisterOffset n,
+                 const RegisterAtom *buf)
 {
     RegisterAccess rv = REG_ACCESS_RESULT_INIT;
-    RegisterAddress last = addr + n - 1;
-
-    for (RegisterHandle i = 0UL; i < t->entries; ++i) {
-        RegisterEntry *e = &t->entry[i];
-        RegisterValue datum;
-        RegisterAtom raw[REG_SIZEOF_LARGEST_DATUM];
-        const RegisterOffset size = rds_size[e->type];
-        const RegisterAddress end = e->address + size - 1;
-        RegisterAddress bs, rs;
-        RegisterOffset rlen;
-
-        /* Skip entries before block start */
-        if (addr > end) {
-            continue;
-        }
-
-        /* Terminate for entries after last */
-        if (e->address > last) {
-            break;
-        }
-
-        /*
-         * What we now need to do is this: Which parts of the entry does the
-         * block touch. There are four cases:
-         *
-         * 1. The block touches the entire entry.
-         * 2. The block only touches end of the entry.
-         * 3. The block only touches the beginning of the entry.
-         * 4. The block only touches an embedded part of the entry (2+3).
-         *
-         * Case 2 can only happen with the first entry that is processed. And
-         * indeed, the first atom of the block has to be used. Conversely, case
-         * 3 can only happen with the last entry being processed. And indeed,
-         * that last atom of the block has to be involved.
-         *
-         * Case 4 is a combination of 2 and three. Thus the entry being proces-
-         * sed has to be first as well as the last and therefore the only entry
-         * that's touched.
-         *
-         * Case 1 covers all the other cases, where all the atoms of an entry
-         * have to be touched while processing.
-         *
-         * Now we need to figure out which atoms of the block map to the entry
-         * we're working on: This is simple though because the new block has a
-         * starting address and a length and every entry knows to which address
-         * in the register-table's address space it is mapped to.
-         *
-         * That means we can just substract the block start address from the
-         * entry's address and have the offset from the block start to find the
-         * atoms that should go into the newly formed binary form of the
-         * register table entry.
-         *
-         * That with the information about which parts are touched tells us
-         * precisely which atoms from the new block should go into the entry's
-         * memory. Perform that in temporary memory.
-         */
-
-        rlen = size;
-        if (addr > e->address) {
-            /* This can only happen with the first entry the block touches. */
-            bs = 0ULL;
-            rs = addr - e->address;
-            rlen -= rs - 1;
-        } else {
-            bs = e->address - addr;
-            rs = 0ULL;
-        }
-
-        if (end > last) {
-            /* This can only happen with the last entry the block touches. */
-            rlen -= bs + size - n;
-        }
+    const RegisterAddress end = addr + n;
+    RegisterHandle en = efirst;
 
-        /* Fetch the entire memory of where the old entry is stored */
-        rv = reg_read_entry(e, raw);
+    /* The block was validated, so the areas it touches are back to back. Hand
+     * each area its part of the block and mark the entries it holds right
+     * after. */
+    for (AreaHandle an = afirst; addr < end; ++an) {
+        assert(an < t->areas);
+        RegisterArea *a = &t->area[an];
+        const RegisterOffset writen = reg_min(a->base + a->size, end) - addr;
+        rv = a->write(a, buf, addr - a->base, writen);
         if (rv.code != REG_ACCESS_SUCCESS) {
-            return rv;
+            break;
         }
-        memcpy(raw + rs, buf + bs, rlen * sizeof(RegisterAtom));
+        buf += writen;
+        addr += writen;
 
-        /* Try the deserialiser, fail if it fails */
-        const bool bigendian = BIT_ISSET(t->flags, REG_TF_BIG_ENDIAN);
-        if (rds_serdes[e->type].des(raw, &datum, bigendian) == false) {
-            rv.code = REG_ACCESS_INVALID;
-            rv.address = addr + bs;
-            return rv;
+        for (; en < t->entries && reg_entry_address(t, en) < addr; ++en) {
+            register_touch(t, en);
+            reg_mark_dirty(t, en);
         }
+    }
 
-        /* Try the validator, fail if it fails */
-        if (rv_validate(t, e, datum) == false) {
-            rv.code = REG_ACCESS_RANGE;
-            rv.address = addr + bs;
-            return rv;
-        }
+    /* One notification for all entries the block changed. */
+    if (en > efirst) {
+        reg_notify(t, efirst, en - 1U);
     }
     return rv;
 }
@@ -869,6 +985,25 @@ reg_atom_from_hexstr(const char *s, const size_t n)
     return rv;
 }
 
+/* The image of an entry's area has to hold the entry's default value in its
+ * serialised form. Comparing that is much cheaper than loading the default
+ * with register_set(), and catches images that went stale. */
+static bool
+reg_image_holds_default(const RegisterTable *t, const RegisterEntry *e)
+{
+    RegisterAtom raw[REG_SIZEOF_LARGEST_DATUM];
+    const RegisterValue def = { .value = e->default_value,
+                                .type = e->type };
+    const bool bigendian = BIT_ISSET(t->flags, REG_TF_BIG_ENDIAN);
+
+    if (rds_serdes[e->type].ser(def, raw, bigendian) == false) {
+        return false;
+    }
+
+    return memcmp(raw, e->area->image + e->offset,
+                  rds_size[e->type] * sizeof(RegisterAtom)) == 0;
+}
+
 static bool
 need_to_load_default(const RegisterEntry *e)
 {
@@ -876,6 +1011,11 @@ need_to_load_default(const RegisterEntry *e)
         return false;
     }
 
+    if (e->area->mem != NULL && e->area->image != NULL) {
+        /* The area's image already contains the default value. */
+        return false;
+    }
+
     if (BIT_ISSET(e->area->flags, REG_AF_SKIP_DEFAULTS)) {
         return false;
     }
@@ -940,6 +1080,37 @@ register_init(RegisterTable *t) /* NOLINT */
         return rv;
     }
 
+    if (t->dirty.map != NULL) {
+        if (t->dirty.words < REGISTER_DIRTY_WORDS(t->entries)) {
+            rv.code = REG_INIT_DIRTY_MAP_TOO_SMALL;
+            rv.pos.entry = t->entries;
+            BIT_CLEAR(t->flags, REG_TF_DURING_INIT);
+            return rv;
+        }
+        for (size_t i = 0U; i < t->dirty.words; ++i) {
+            t->dirty.map[i] = 0U;
+        }
+        t->dirty.epoch = 0UL;
+    }
+
+    if (t->index.address != NULL) {
+        if (t->index.size < t->entries) {
+            rv.code = REG_INIT_INDEX_TOO_SMALL;
+            rv.pos.entry = t->entries;
+            BIT_CLEAR(t->flags, REG_TF_DURING_INIT);
+            return rv;
+        }
+        for (RegisterHandle i = 0UL; i < t->entries; ++i) {
+            t->index.address[i] = t->entry[i].address;
+            t->index.type[i] = (uint8_t)t->entry[i].type;
+        }
+    }
+
+    t->observers.count = 0U;
+    t->observers.queue.head = 0U;
+    t->observers.queue.tail = 0U;
+    t->observers.queue.lost = 0U;
+
     if (t->areas == 0UL) {
         rv.code = REG_INIT_NO_AREAS;
         rv.pos.area = 0;
@@ -993,23 +1164,50 @@ register_init(RegisterTable *t) /* NOLINT */
      * memory to zero upon boot then...
      */
     for (AreaHandle i = 0UL; i < t->areas; ++i) {
-        if (t->area[i].mem != NULL) {
-            memset(t->area[i].mem, 0, t->area[i].size * sizeof(RegisterAtom));
+        RegisterArea *a = &t->area[i];
+        if (BIT_ISSET(a->flags, REG_AF_DOUBLE_BUFFER)) {
+            if (a->mem == NULL || a->shadow == NULL) {
+                rv.code = REG_INIT_AREA_NO_SHADOW;
+                rv.pos.area = i;
+                BIT_CLEAR(t->flags, REG_TF_DURING_INIT);
+                return rv;
+            }
+            /* Defaults are staged like any other write, and published once
+             * all of them are loaded. */
+            BIT_SET(a->flags, REG_AF_SHADOW_STALE);
+        }
+        if (a->mem == NULL) {
+            continue;
+        }
+        if (a->image != NULL) {
+            /* Memory areas with a default image are set up in one go. */
+            memcpy(a->mem, a->image, a->size * sizeof(RegisterAtom));
+        } else {
+            memset(a->mem, 0, a->size * sizeof(RegisterAtom));
         }
     }
 
     BIT_SET(t->flags, REG_TF_INITIALISED);
+    AreaHandle an = 0U;
     for (RegisterHandle i = 0UL; i < t->entries; ++i) {
         RegisterEntry *e = &t->entry[i];
         /* Link into register table memory */
-        bool success = reg_entry_is_in_memory(t, e);
+        bool success = reg_entry_is_in_memory(t, &an, e);
         if (success == false) {
             rv.code = REG_INIT_ENTRY_IN_MEMORY_HOLE;
             rv.pos.entry = i;
             BIT_CLEAR(t->flags, REG_TF_INITIALISED | REG_TF_DURING_INIT);
             return rv;
         }
-        e->area = &t->area[ra_find_area_by_addr(t, e->address)];
+
+        if (e->area->mem != NULL && e->area->image != NULL
+            && reg_image_holds_default(t, e) == false)
+        {
+            rv.code = REG_INIT_ENTRY_IMAGE_MISMATCH;
+            rv.pos.entry = i;
+            BIT_CLEAR(t->flags, REG_TF_INITIALISED | REG_TF_DURING_INIT);
+            return rv;
+        }
 
         if (need_to_load_default(e)) {
             RegisterAccess access;
@@ -1028,6 +1226,12 @@ register_init(RegisterTable *t) /* NOLINT */
         }
     }
 
+    for (AreaHandle i = 0UL; i < t->areas; ++i) {
+        if (BIT_ISSET(t->area[i].flags, REG_AF_DOUBLE_BUFFER)) {
+            ra_swap(&t->area[i]);
+        }
+    }
+
     /* Now link entries back into their area (first and last) */
     RegisterHandle entry = 0UL;
     for (AreaHandle i = 0UL; i < t->areas; ++i) {
@@ -1155,7 +1359,15 @@ register_setx(RegisterTable *t, const RegisterHandle idx,
         return rv;
     }
 
-    return a->write(a, raw, e->offset, rds_size[e->type]);
+    rv = a->write(a, raw, e->offset, rds_size[e->type]);
+    /* Loading defaults during initialisation is not a change. */
+    const bool init = BIT_ISSET(t->flags, REG_TF_DURING_INIT);
+    if (rv.code == REG_ACCESS_SUCCESS && init == false) {
+        reg_mark_dirty(t, idx);
+        reg_notify(t, idx, idx);
+    }
+
+    return rv;
 }
 
 RegisterAccess
@@ -1212,98 +1424,615 @@ register_get(RegisterTable *t, RegisterHandle idx, RegisterValue *v)
     return rv;
 }
 
-/**
- * Set bits in a register
- *
- * This function reads a register, sets the bits indicated by the ‘v’ parameter
- * and writes the resulting value back to the register. The type of this ‘v’
- * parameter must match the one of the register addressed by ’idx’. Note that
- * bitwise manipulation is only supported on unsigned integer register types.
- *
- * REG_ACCESS_INVALID is returned either when the given register type does not
- * match to the one read from the register table or when the register type is
- * not supported, for example, float or signed integers.
- *
- * If the given address to the register is out of range, the function returns
- * immediately with the return code of REG_ACCESS_NOENTRY.
- *
- * If the provided register table is not initialised by ‘register_init()’, the
- * function immediately returns setting the return code to
- * REG_ACCESS_UNINITIALISED.
- *
- * @param  t     Pointer to the register table to work on
- * @param  idx   RegisterHandle (index) of the target register inside ‘t’
- * @param  v     Pointer to the register value where the target bit is set
- *
- * @return REG_ACCESS_INVALID       if the given type is mismatching or unsupported;
- *         REG_ACCESS_NOENTRY       if the given idx is out of range;
- *         REG_ACCESS_UNINITIALISED if the table isn't initialised;
- *         REG_ACCESS_SUCCESS otherwise.
+/*
+ * Batched access
  *
- * @sideeffects A bit in the register at the given idx is set to 1.
+ * Entries in plain memory areas are (de)serialised in place, without going
+ * through the area's callbacks. Adjacent entries in other areas are combined
+ * into a single callback invocation of up to REG_MANY_CHUNK atoms.
  */
-RegisterAccess
-register_bit_set(RegisterTable *t,
-                 const RegisterHandle idx,
-                 const RegisterValue v)
+
+#define REG_MANY_CHUNK 16U
+
+static inline bool
+ra_reads_plain_memory(const RegisterArea *a)
+{
+    return (a->mem != NULL && a->read == reg_mem_read);
+}
+
+static inline bool
+ra_writes_plain_memory(const RegisterArea *a)
+{
+    return (a->mem != NULL && a->write == reg_mem_write);
+}
+
+static RegisterAccess
+reg_many_check(RegisterTable *t, const RegisterHandle *h, const size_t n)
 {
     RegisterAccess rv = REG_ACCESS_RESULT_INIT;
-    RegisterValue reg;
 
-    rv = register_get(t, idx, &reg);
-    if (rv.code != REG_ACCESS_SUCCESS) {
+    if (BIT_ISSET(t->flags, REG_TF_INITIALISED) == false) {
+        rv.code = REG_ACCESS_UNINITIALISED;
+        rv.address = (n > 0U) ? h[0] : 0U;
         return rv;
     }
 
-    if (reg.type != v.type) {
-        goto invalid;
+    for (size_t i = 0U; i < n; ++i) {
+        if (h[i] >= t->entries) {
+            rv.code = REG_ACCESS_NOENTRY;
+            rv.address = h[i];
+            return rv;
+        }
     }
 
-    switch (reg.type) {
-    case REG_TYPE_UINT16:
-        BIT_SET(reg.value.u16, v.value.u16);
-        break;
-    case REG_TYPE_UINT32:
-        BIT_SET(reg.value.u32, v.value.u32);
-        break;
-    case REG_TYPE_UINT64:
-        BIT_SET(reg.value.u64, v.value.u64);
-        break;
-    case REG_TYPE_SINT16:
-        /* FALLTHROUGH */
-    case REG_TYPE_SINT32:
-        /* FALLTHROUGH */
-    case REG_TYPE_SINT64:
-        /* FALLTHROUGH */
-    case REG_TYPE_FLOAT32:
-        /* FALLTHROUGH */
-    case REG_TYPE_FLOAT64:
-        /* FALLTHROUGH */
-    case REG_TYPE_INVALID:
-        goto invalid;
-    }
-    rv = register_set(t, idx, reg);
     return rv;
+}
 
-invalid:
-    rv.code = REG_ACCESS_INVALID;
-    rv.address = idx;
-    return rv;
+/* Number of entries, starting at h[i], that can be transferred with a single
+ * callback invocation: Consecutive handles in the same area, that are
+ * adjacent in the address space. */
+static size_t
+reg_many_run(const RegisterTable *t, const RegisterHandle *h,
+             const size_t i, const size_t n)
+{
+    const RegisterEntry *first = &t->entry[h[i]];
+    RegisterAddress end = first->address + rds_size[first->type];
+    size_t k = 1U;
+
+    while (i + k < n && h[i + k] == h[i + k - 1U] + 1U) {
+        const RegisterEntry *e = &t->entry[h[i + k]];
+        const RegisterAddress next = e->address + rds_size[e->type];
+        if (e->area != first->area || e->address != end
+            || (next - first->address) > REG_MANY_CHUNK)
+        {
+            break;
+        }
+        end = next;
+        k++;
+    }
+
+    return k;
 }
 
-/**
- * Clear bits in a register
- *
- * This function reads a register, clears the bits indicated by the ‘v’
- * parameter and writes the resulting value back to the register. The type of
- * this ‘v’ parameter must match the one of the register addressed by ’idx’.
- * Note that bitwise manipulation is only supported on unsigned integer
- * register types.
- *
- * REG_ACCESS_INVALID is returned either when the given register type does not
- * match to the one read from the register table or when the register type is
- * not supported, for example, float or signed integers.
- *
+/* Memory that writes to an area go to. For double-buffered areas, that is the
+ * shadow copy, which is brought up to date first, if a publish left it stale.
+ * Callers have to be in the area's write section. */
+static RegisterAtom *
+ra_staging(RegisterArea *a)
+{
+    if (BIT_ISSET(a->flags, REG_AF_DOUBLE_BUFFER) == false) {
+        return a->mem;
+    }
+    if (BIT_ISSET(a->flags, REG_AF_SHADOW_STALE)) {
+        memcpy(a->shadow, a->mem, a->size * sizeof(RegisterAtom));
+        BIT_CLEAR(a->flags, REG_AF_SHADOW_STALE);
+    }
+    return a->shadow;
+}
+
+/* Make the shadow copy of a double-buffered area visible. Callers have to be
+ * in the area's write section. */
+static void
+ra_swap(RegisterArea *a)
+{
+    if (BIT_ISSET(a->flags, REG_AF_SHADOW_STALE)) {
+        /* Nothing was staged since the last swap. */
+        return;
+    }
+    RegisterAtom *staged = a->shadow;
+    a->shadow = a->mem;
+    a->mem = staged;
+    BIT_SET(a->flags, REG_AF_SHADOW_STALE);
+}
+
+/* Publish a double-buffered area, and mark the entries whose value changed by
+ * it dirty. Returns true if there are any, with their handles ranging from
+ * ‘first’ to ‘last’. Callers have to be in the area's write section, and
+ * notify observers of that range after leaving it. */
+static bool
+ra_publish(RegisterTable *t, RegisterArea *a, RegisterHandle *first,
+           RegisterHandle *last)
+{
+    bool changed = false;
+
+    if (BIT_ISSET(a->flags, REG_AF_SHADOW_STALE)) {
+        return false;
+    }
+    ra_swap(a);
+
+    /* The shadow copy still holds what was published before. */
+    for (RegisterHandle i = a->entry.first;
+         a->entry.count > 0U && i <= a->entry.last; ++i)
+    {
+        const RegisterEntry *e = &t->entry[i];
+        if (memcmp(a->mem + e->offset, a->shadow + e->offset,
+                   rds_size[e->type] * sizeof(RegisterAtom)) == 0)
+        {
+            continue;
+        }
+        register_mark_dirty(t, i);
+        if (changed == false) {
+            *first = i;
+            changed = true;
+        }
+        *last = i;
+    }
+
+    return changed;
+}
+
+/* Number of entries, starting at h[i], that live in the same area. */
+static size_t
+reg_many_same_area(const RegisterTable *t, const RegisterHandle *h,
+                   const size_t i, const size_t n)
+{
+    const RegisterArea *a = t->entry[h[i]].area;
+    size_t k = 1U;
+    while (i + k < n && t->entry[h[i + k]].area == a) {
+        k++;
+    }
+    return k;
+}
+
+/**
+ * Read a number of registers
+ *
+ * This is equivalent to calling register_get() for each handle in h, in
+ * order, storing the results in v. Handles may be in any order, but calls
+ * with runs of consecutive handles allow for combining reads from areas that
+ * are not plain memory.
+ *
+ * @param  t     Pointer to the register table to work on
+ * @param  h     Array of handles of the registers to read
+ * @param  n     Number of handles in h
+ * @param  v     Array of at least n values to store the results in
+ *
+ * @return REG_ACCESS_UNINITIALISED if the table isn't initialised;
+ *         REG_ACCESS_NOENTRY if any handle is out of range, with the address
+ *         field set to that handle; otherwise the result of the first failing
+ *         read or deserialisation; REG_ACCESS_SUCCESS if all reads worked.
+ * @sideeffects Modifies v; reads from areas may cause side effects.
+ */
+RegisterAccess
+register_get_many(RegisterTable *t, const RegisterHandle *h, const size_t n,
+                  RegisterValue *v)
+{
+    RegisterAccess rv = reg_many_check(t, h, n);
+    if (rv.code != REG_ACCESS_SUCCESS) {
+        return rv;
+    }
+
+    const bool bigendian = BIT_ISSET(t->flags, REG_TF_BIG_ENDIAN);
+    size_t i = 0U;
+    while (i < n) {
+        const RegisterEntry *e = &t->entry[h[i]];
+        const RegisterArea *a = e->area;
+
+        if (ra_reads_plain_memory(a)) {
+            /* Deserialise all following entries of this area within one
+             * read section, so they are consistent with each other. */
+            const size_t k = reg_many_same_area(t, h, i, n);
+            RegisterSequence s;
+            size_t fail;
+            do {
+                s = register_area_read_begin(a);
+                fail = n;
+                for (size_t j = i; j < i + k; ++j) {
+                    const RegisterEntry *c = &t->entry[h[j]];
+                    if (rds_serdes[c->type].des(a->mem + c->offset, v + j,
+                                                bigendian) == false
+                        && fail == n)
+                    {
+                        fail = j;
+                    }
+                }
+            } while (register_area_read_retry(a, s));
+            if (fail < n) {
+                rv.code = REG_ACCESS_INVALID;
+                rv.address = h[fail];
+                return rv;
+            }
+            i += k;
+            continue;
+        }
+
+        RegisterAtom raw[REG_MANY_CHUNK];
+        const size_t k = reg_many_run(t, h, i, n);
+        const RegisterEntry *last = &t->entry[h[i + k - 1U]];
+        const RegisterOffset atoms = last->offset + rds_size[last->type]
+            - e->offset;
+
+        rv = a->read(a, raw, e->offset, atoms);
+        if (rv.code != REG_ACCESS_SUCCESS) {
+            return rv;
+        }
+
+        for (size_t j = i; j < i + k; ++j) {
+            const RegisterEntry *c = &t->entry[h[j]];
+            if (rds_serdes[c->type].des(raw + (c->offset - e->offset), v + j,
+                                        bigendian) == false)
+            {
+                rv.code = REG_ACCESS_INVALID;
+                rv.address = h[j];
+                return rv;
+            }
+        }
+        i += k;
+    }
+
+    return rv;
+}
+
+static bool
+rv_serialisable(const RegisterValue v)
+{
+    /* The float serialisers reject everything but zero and normal numbers;
+     * knowing that upfront avoids failing after part of a batch is written. */
+    switch (v.type) {
+    case REG_TYPE_FLOAT32:
+        return (v.value.f32 == 0.F) || (isnormal(v.value.f32) == true);
+    case REG_TYPE_FLOAT64:
+        return (v.value.f64 == 0.) || (isnormal(v.value.f64) == true);
+    default:
+        return true;
+    }
+}
+
+/**
+ * Write a number of registers
+ *
+ * This is equivalent to calling register_set() for each handle in h, with
+ * the corresponding value from v, except that all values are validated
+ * before any of them is written. If any value is rejected, no register is
+ * changed. Like with register_get_many(), runs of consecutive handles allow
+ * combining writes to areas that are not plain memory.
+ *
+ * @param  t     Pointer to the register table to work on
+ * @param  h     Array of handles of the registers to write
+ * @param  n     Number of handles in h
+ * @param  v     Array of n values to write
+ *
+ * @return REG_ACCESS_UNINITIALISED if the table isn't initialised;
+ *         REG_ACCESS_NOENTRY if any handle is out of range;
+ *         REG_ACCESS_RANGE if a value does not validate;
+ *         REG_ACCESS_READONLY if a register cannot be written;
+ *         REG_ACCESS_INVALID if a value cannot be serialised; otherwise the
+ *         result of the first failing write; REG_ACCESS_SUCCESS if all
+ *         writes worked. The address field is set to the first offending
+ *         register's address (or handle, with REG_ACCESS_NOENTRY).
+ * @sideeffects Modifies registers in the table; writes to areas may cause
+ *              side effects; notifies observers once per run of
+ *              consecutive handles.
+ */
+RegisterAccess
+register_set_many(RegisterTable *t, const RegisterHandle *h, const size_t n,
+                  const RegisterValue *v)
+{
+    RegisterAccess rv = reg_many_check(t, h, n);
+    if (rv.code != REG_ACCESS_SUCCESS) {
+        return rv;
+    }
+
+    for (size_t i = 0U; i < n; ++i) {
+        RegisterEntry *e = &t->entry[h[i]];
+        if (rv_validate(t, e, v[i]) == false) {
+            rv.code = REG_ACCESS_RANGE;
+            rv.address = e->address;
+            return rv;
+        }
+        if (register_area_can_write(e->area) == false) {
+            rv.code = REG_ACCESS_READONLY;
+            rv.address = e->address;
+            return rv;
+        }
+        if (rv_serialisable(v[i]) == false) {
+            rv.code = REG_ACCESS_INVALID;
+            rv.address = e->address;
+            return rv;
+        }
+    }
+
+    const bool bigendian = BIT_ISSET(t->flags, REG_TF_BIG_ENDIAN);
+    const bool init = BIT_ISSET(t->flags, REG_TF_DURING_INIT);
+    size_t i = 0U;
+    while (i < n) {
+        const RegisterEntry *e = &t->entry[h[i]];
+        RegisterArea *a = e->area;
+
+        if (ra_writes_plain_memory(a)) {
+            const size_t k = reg_many_same_area(t, h, i, n);
+            register_area_write_begin(a);
+            RegisterAtom *mem = ra_staging(a);
+            for (size_t j = i; j < i + k; ++j) {
+                const RegisterEntry *c = &t->entry[h[j]];
+                (void)rds_serdes[c->type].ser(v[j], mem + c->offset,
+                                              bigendian);
+            }
+            register_area_write_end(a);
+            if (init == false) {
+                for (size_t j = i; j < i + k; ++j) {
+                    reg_mark_dirty(t, h[j]);
+                }
+            }
+            i += k;
+            continue;
+        }
+
+        RegisterAtom raw[REG_MANY_CHUNK];
+        const size_t k = reg_many_run(t, h, i, n);
+        const RegisterEntry *last = &t->entry[h[i + k - 1U]];
+        const RegisterOffset atoms = last->offset + rds_size[last->type]
+            - e->offset;
+
+        for (size_t j = i; j < i + k; ++j) {
+            const RegisterEntry *c = &t->entry[h[j]];
+            (void)rds_serdes[c->type].ser(v[j], raw + (c->offset - e->offset),
+                                          bigendian);
+        }
+
+        rv = a->write(a, raw, e->offset, atoms);
+        if (rv.code != REG_ACCESS_SUCCESS) {
+            break;
+        }
+
+        if (init == false) {
+            for (size_t j = i; j < i + k; ++j) {
+                reg_mark_dirty(t, h[j]);
+            }
+        }
+        i += k;
+    }
+
+    /* Notify observers of what was written, even if a write failed. */
+    if (init == false) {
+        reg_notify_handles(t, h, i);
+    }
+    return rv;
+}
+
+/*
+ * Read-modify-write
+ *
+ * Bit manipulation and compare-and-swap read a register, compute the new
+ * value, validate it and write it back. For memory areas this happens within
+ * the area's write section, so it is atomic with respect to other writers
+ * when sequence locks are enabled. The table's critical section hooks, if
+ * set, are called around the whole operation, which allows ports to mask
+ * interrupts on targets without atomics. They are entered before the write
+ * section and left after it: An interrupt handler, that reads the area while
+ * the sequence counter is odd, would otherwise spin forever on the writer it
+ * preempted. Without the hooks, this is a plain read-modify-write.
+ */
+
+typedef enum RegisterRMW {
+    REG_RMW_BIT_SET,
+    REG_RMW_BIT_CLEAR,
+    REG_RMW_CAS
+} RegisterRMW;
+
+static bool
+rv_apply_bitop(RegisterValue *reg, const RegisterValue v, const bool set)
+{
+    switch (reg->type) {
+    case REG_TYPE_UINT16:
+        if (set) {
+            BIT_SET(reg->value.u16, v.value.u16);
+        } else {
+            BIT_CLEAR(reg->value.u16, v.value.u16);
+        }
+        return true;
+    case REG_TYPE_UINT32:
+        if (set) {
+            BIT_SET(reg->value.u32, v.value.u32);
+        } else {
+            BIT_CLEAR(reg->value.u32, v.value.u32);
+        }
+        return true;
+    case REG_TYPE_UINT64:
+        if (set) {
+            BIT_SET(reg->value.u64, v.value.u64);
+        } else {
+            BIT_CLEAR(reg->value.u64, v.value.u64);
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+static inline bool
+reg_rmw_type_ok(const RegisterEntry *e, const RegisterValue v,
+                const RegisterRMW op)
+{
+    if (e->type != v.type) {
+        return false;
+    }
+    if (op == REG_RMW_CAS) {
+        return true;
+    }
+    return (e->type == REG_TYPE_UINT16
+            || e->type == REG_TYPE_UINT32
+            || e->type == REG_TYPE_UINT64);
+}
+
+static RegisterAccess
+reg_rmw_locked(RegisterTable *t, RegisterEntry *e, const bool memory,
+               RegisterValue *expected, const RegisterValue v,
+               const RegisterRMW op)
+{
+    RegisterAtom raw[REG_SIZEOF_LARGEST_DATUM];
+    RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+    RegisterArea *a = e->area;
+    RegisterAtom *p = memory ? ra_staging(a) + e->offset : raw;
+    const bool bigendian = BIT_ISSET(t->flags, REG_TF_BIG_ENDIAN);
+    RegisterValue reg;
+
+    if (memory == false) {
+        rv = a->read(a, raw, e->offset, rds_size[e->type]);
+        if (rv.code != REG_ACCESS_SUCCESS) {
+            return rv;
+        }
+    }
+
+    if (rds_serdes[e->type].des(p, &reg, bigendian) == false) {
+        rv.code = REG_ACCESS_INVALID;
+        rv.address = e->address;
+        return rv;
+    }
+
+    if (op == REG_RMW_CAS) {
+        if (register_value_compare(&reg, expected) == false) {
+            *expected = reg;
+            rv.code = REG_ACCESS_MISMATCH;
+            rv.address = e->address;
+            return rv;
+        }
+        reg = v;
+    } else {
+        (void)rv_apply_bitop(&reg, v, op == REG_RMW_BIT_SET);
+    }
+
+    if (rv_validate(t, e, reg) == false) {
+        rv.code = REG_ACCESS_RANGE;
+        rv.address = e->address;
+        return rv;
+    }
+
+    if (rds_serdes[e->type].ser(reg, p, bigendian) == false) {
+        rv.code = REG_ACCESS_INVALID;
+        rv.address = e->address;
+        return rv;
+    }
+
+    if (memory == false) {
+        rv = a->write(a, raw, e->offset, rds_size[e->type]);
+    }
+
+    return rv;
+}
+
+static RegisterAccess
+reg_rmw(RegisterTable *t, const RegisterHandle idx, RegisterValue *expected,
+        const RegisterValue v, const RegisterRMW op)
+{
+    RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+
+    if (BIT_ISSET(t->flags, REG_TF_INITIALISED) == false) {
+        rv.code = REG_ACCESS_UNINITIALISED;
+        rv.address = idx;
+        return rv;
+    }
+
+    if (idx >= t->entries) {
+        rv.code = REG_ACCESS_NOENTRY;
+        rv.address = idx;
+        return rv;
+    }
+
+    RegisterEntry *e = &t->entry[idx];
+    if (reg_rmw_type_ok(e, v, op) == false
+        || (op == REG_RMW_CAS && expected->type != e->type))
+    {
+        rv.code = REG_ACCESS_INVALID;
+        rv.address = idx;
+        return rv;
+    }
+
+    RegisterArea *a = e->area;
+    if (register_area_can_write(a) == false) {
+        rv.code = REG_ACCESS_READONLY;
+        rv.address = e->address;
+        return rv;
+    }
+
+    /* Memory areas are accessed directly, because the memory callbacks would
+     * try to enter the write section this holds. */
+    const bool memory = ra_reads_plain_memory(a) && ra_writes_plain_memory(a);
+    uint32_t state = 0U;
+
+    if (t->critical.enter != NULL) {
+        state = t->critical.enter();
+    }
+    if (memory) {
+        register_area_write_begin(a);
+    }
+
+    rv = reg_rmw_locked(t, e, memory, expected, v, op);
+
+    if (memory) {
+        register_area_write_end(a);
+    }
+    if (t->critical.leave != NULL) {
+        t->critical.leave(state);
+    }
+
+    if (rv.code == REG_ACCESS_SUCCESS
+        && BIT_ISSET(t->flags, REG_TF_DURING_INIT) == false)
+    {
+        reg_mark_dirty(t, idx);
+        reg_notify(t, idx, idx);
+    }
+
+    return rv;
+}
+
+/**
+ * Set bits in a register
+ *
+ * This function reads a register, sets the bits indicated by the ‘v’ parameter
+ * and writes the resulting value back to the register. This is a single
+ * atomic operation only if the table's critical section hooks are set (see
+ * register_cas() for details). The type of this ‘v’ parameter
+ * must match the one of the register addressed by ’idx’. Note that bitwise
+ * manipulation is only supported on unsigned integer register types. The
+ * resulting value is subject to the register's validator.
+ *
+ * REG_ACCESS_INVALID is returned either when the given register type does not
+ * match to the one read from the register table or when the register type is
+ * not supported, for example, float or signed integers.
+ *
+ * If the given address to the register is out of range, the function returns
+ * immediately with the return code of REG_ACCESS_NOENTRY.
+ *
+ * If the provided register table is not initialised by ‘register_init()’, the
+ * function immediately returns setting the return code to
+ * REG_ACCESS_UNINITIALISED.
+ *
+ * @param  t     Pointer to the register table to work on
+ * @param  idx   RegisterHandle (index) of the target register inside ‘t’
+ * @param  v     Pointer to the register value where the target bit is set
+ *
+ * @return REG_ACCESS_INVALID       if the given type is mismatching or unsupported;
+ *         REG_ACCESS_NOENTRY       if the given idx is out of range;
+ *         REG_ACCESS_UNINITIALISED if the table isn't initialised;
+ *         REG_ACCESS_RANGE         if the result does not validate;
+ *         REG_ACCESS_SUCCESS otherwise.
+ *
+ * @sideeffects A bit in the register at the given idx is set to 1.
+ */
+RegisterAccess
+register_bit_set(RegisterTable *t,
+                 const RegisterHandle idx,
+                 const RegisterValue v)
+{
+    return reg_rmw(t, idx, NULL, v, REG_RMW_BIT_SET);
+}
+
+/**
+ * Clear bits in a register
+ *
+ * This function reads a register, clears the bits indicated by the ‘v’
+ * parameter and writes the resulting value back to the register. This is a
+ * single atomic operation only if the table's critical section hooks are set
+ * (see register_cas() for details). The type of this ‘v’ parameter must
+ * match the one of the register addressed by ’idx’. Note that bitwise
+ * manipulation is only supported on unsigned integer register types. The
+ * resulting value is subject to the register's validator.
+ *
+ * REG_ACCESS_INVALID is returned either when the given register type does not
+ * match to the one read from the register table or when the register type is
+ * not supported, for example, float or signed integers.
+ *
  * If the given address to the register is out of range, the function returns
  * immediately with the return code of REG_ACCESS_NOENTRY.
  *
@@ -1318,6 +2047,7 @@ invalid:
  * @return REG_ACCESS_INVALID       if the given type is mismatching or unsupported;
  *         REG_ACCESS_NOENTRY       if the given idx is out of range;
  *         REG_ACCESS_UNINITIALISED if the table isn't initialised;
+ *         REG_ACCESS_RANGE         if the result does not validate;
  *         REG_ACCESS_SUCCESS otherwise.
  *
  * @sideeffects A bit in the register at the given idx is set to 0.
@@ -1327,48 +2057,46 @@ register_bit_clear(RegisterTable *t,
                    const RegisterHandle idx,
                    const RegisterValue v)
 {
-    RegisterAccess rv = REG_ACCESS_RESULT_INIT;
-    RegisterValue reg;
-
-    rv = register_get(t, idx, &reg);
-    if (rv.code != REG_ACCESS_SUCCESS) {
-        return rv;
-    }
-
-    if (reg.type != v.type) {
-        goto invalid;
-    }
-
-    switch (reg.type) {
-    case REG_TYPE_UINT16:
-        BIT_CLEAR(reg.value.u16, v.value.u16);
-        break;
-    case REG_TYPE_UINT32:
-        BIT_CLEAR(reg.value.u32, v.value.u32);
-        break;
-    case REG_TYPE_UINT64:
-        BIT_CLEAR(reg.value.u64, v.value.u64);
-        break;
-    case REG_TYPE_SINT16:
-        /* FALLTHROUGH */
-    case REG_TYPE_SINT32:
-        /* FALLTHROUGH */
-    case REG_TYPE_SINT64:
-        /* FALLTHROUGH */
-    case REG_TYPE_FLOAT32:
-        /* FALLTHROUGH */
-    case REG_TYPE_FLOAT64:
-        /* FALLTHROUGH */
-    case REG_TYPE_INVALID:
-        goto invalid;
-    }
-    rv = register_set(t, idx, reg);
-    return rv;
+    return reg_rmw(t, idx, NULL, v, REG_RMW_BIT_CLEAR);
+}
 
-invalid:
-    rv.code = REG_ACCESS_INVALID;
-    rv.address = idx;
-    return rv;
+/**
+ * Compare and swap a register's value
+ *
+ * If the register addressed by ‘idx’ holds the value ‘*expected’, it is
+ * replaced by ‘desired’. Otherwise the register is left alone, and its
+ * current value is stored in ‘*expected’, so callers can retry.
+ *
+ * Reading, comparing and writing form a single atomic operation only if the
+ * table's critical section hooks are set: The operation runs between them,
+ * for all kinds of areas. On single-core targets, masking interrupts in these
+ * hooks makes the operation atomic with respect to interrupt handlers.
+ * Without the hooks, this is a plain read-modify-write. For memory areas, it
+ * still happens in the area's write section, which excludes writers on other
+ * threads when sequence locks are enabled (see register_area_write_begin()).
+ *
+ * @param  t         Pointer to the register table to work on
+ * @param  idx       RegisterHandle (index) of the target register inside ‘t’
+ * @param  expected  Pointer to the value the register is expected to hold
+ * @param  desired   Value to store in the register
+ *
+ * @return REG_ACCESS_INVALID       if a type is mismatching, or the desired
+ *                                  value cannot be stored;
+ *         REG_ACCESS_NOENTRY       if the given idx is out of range;
+ *         REG_ACCESS_UNINITIALISED if the table isn't initialised;
+ *         REG_ACCESS_READONLY      if the register cannot be written;
+ *         REG_ACCESS_RANGE         if the desired value does not validate;
+ *         REG_ACCESS_MISMATCH      if the register did not hold the expected
+ *                                  value;
+ *         REG_ACCESS_SUCCESS otherwise.
+ *
+ * @sideeffects Modifies the register, or ‘*expected’ on mismatch.
+ */
+RegisterAccess
+register_cas(RegisterTable *t, const RegisterHandle idx,
+             RegisterValue *expected, const RegisterValue desired)
+{
+    return reg_rmw(t, idx, expected, desired, REG_RMW_CAS);
 }
 
 RegisterAccess
@@ -1405,11 +2133,13 @@ register_block_read_unsafe(RegisterTable *t, RegisterAddress addr,
 {
     RegisterAccess rv;
     RegisterOffset rest = n;
+    AreaHandle an = 0U;
     while (rest > 0ULL) {
-        AreaHandle an = ra_find_area_by_addr(t, addr);
         RegisterOffset offset, readn;
         RegisterArea *a;
 
+        /* Areas are sorted, so the next one is never below the last. */
+        an = ra_find_area_from(t, an, addr);
         assert(an < t->areas);
         a = &t->area[an];
         offset = addr - a->base;
@@ -1439,11 +2169,13 @@ register_block_write_unsafe(RegisterTable *t, RegisterAddress addr,
 {
     RegisterAccess rv;
     RegisterOffset rest = n;
+    AreaHandle an = 0U;
     while (rest > 0ULL) {
-        AreaHandle an = ra_find_area_by_addr(t, addr);
         RegisterOffset offset, writen;
         RegisterArea *a;
 
+        /* Areas are sorted, so the next one is never below the last. */
+        an = ra_find_area_from(t, an, addr);
         assert(an < t->areas);
         a = &t->area[an];
         offset = addr - a->base;
@@ -1501,34 +2233,21 @@ register_block_write(RegisterTable *t, RegisterAddress addr,
         return rv;
     }
 
-    rv = ra_writeable(t, addr, n);
-    if (rv.code != REG_ACCESS_SUCCESS) {
-        return rv;
-    }
-
-    /* Make sure the block write instruction does not want to write into
-     * an address that does not map to an area in the register table. */
-
-    rv = register_block_touches_hole(t, addr, n);
-    if (rv.code != REG_ACCESS_SUCCESS) {
-        return rv;
-    }
+    /* Validation and commit both walk the areas and entries the block touches
+     * from its start, so their cost depends on the size of the block, not on
+     * that of the table. */
+    const AreaHandle afirst = ra_first_ending_after(t, 0UL, t->areas, addr);
+    const RegisterHandle efirst = reg_first_ending_after(t, 0UL, t->entries,
+                                                         addr);
 
-    rv = ra_malformed_write(t, addr, n, buf);
+    rv = reg_block_validate(t, afirst, efirst, addr, n, buf);
     if (rv.code != REG_ACCESS_SUCCESS) {
         return rv;
     }
 
-    /* If the previous validation steps succeeded, it is safe to push this
-     * chunk of memory into the referenced register table. Since we checked for
-     * all errors before hand, it is safe to use this function. */
-
-    rv = register_block_write_unsafe(t, addr, n, buf);
-    if (rv.code != REG_ACCESS_SUCCESS) {
-        return rv;
-    }
-    reg_taint_in_range(t, addr, n);
-    return rv;
+    /* If validation succeeded, it is safe to push this chunk of memory into
+     * the referenced register table. */
+    return reg_block_commit(t, afirst, efirst, addr, n, buf);
 }
 
 RegisterAccess
@@ -1536,7 +2255,11 @@ reg_mem_read(const RegisterArea *a, RegisterAtom *dest,
              RegisterOffset offset, RegisterOffset n)
 {
     RegisterAccess rv = REG_ACCESS_RESULT_INIT;
-    memcpy(dest, a->mem + offset, n * sizeof(RegisterAtom));
+    RegisterSequence s;
+    do {
+        s = register_area_read_begin(a);
+        memcpy(dest, a->mem + offset, n * sizeof(RegisterAtom));
+    } while (register_area_read_retry(a, s));
     return rv;
 }
 
@@ -1545,7 +2268,9 @@ reg_mem_write(RegisterArea *a, const RegisterAtom *src,
               RegisterOffset offset, RegisterOffset n)
 {
     RegisterAccess rv = REG_ACCESS_RESULT_INIT;
-    memcpy(a->mem + offset, src, n * sizeof(RegisterAtom));
+    register_area_write_begin(a);
+    memcpy(ra_staging(a) + offset, src, n * sizeof(RegisterAtom));
+    register_area_write_end(a);
     return rv;
 }
 
@@ -1555,10 +2280,12 @@ register_block_touches_hole(RegisterTable *t, RegisterAddress addr,
 {
     RegisterAccess rv = REG_ACCESS_RESULT_INIT;
     RegisterOffset rest = n;
+    AreaHandle an = 0U;
     while (rest > 0) {
         RegisterArea *a;
         RegisterOffset used;
-        AreaHandle an = ra_find_area_by_addr(t, addr);
+
+        an = ra_find_area_from(t, an, addr);
 
         if (an == t->areas) {
             rv.code = REG_ACCESS_NOENTRY;
@@ -1579,6 +2306,7 @@ register_set_from_hexstr(RegisterTable *t, const RegisterAddress start,
                          const char *str, const size_t n)
 {
     RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+    RegisterOffset done = 0U;
 
     for (size_t idx = 0; idx < n; idx += 4U) {
         const char *cur = str+idx;
@@ -1589,20 +2317,20 @@ register_set_from_hexstr(RegisterTable *t, const RegisterAddress start,
         if (ah >= t->areas) {
             rv.code = REG_ACCESS_NOENTRY;
             rv.address = ca;
-            return rv;
+            break;
         }
 
         const RegisterArea *area = &t->area[ah];
         if (register_area_can_write(area) == false) {
             rv.code = REG_ACCESS_READONLY;
             rv.address = ca;
-            return rv;
+            break;
         }
 
         if (reg_is_hexstr(cur, cn) == false) {
             rv.code = REG_ACCESS_INVALID;
             rv.address = ca;
-            return rv;
+            break;
         }
 
         const RegisterAtom value = reg_atom_from_hexstr(cur, cn);
@@ -1610,10 +2338,13 @@ register_set_from_hexstr(RegisterTable *t, const RegisterAddress start,
         const size_t size = rds_size[REG_TYPE_UINT16];
         rv = area->write((RegisterArea*)area, &value, o, size);
         if (rv.code != REG_ACCESS_SUCCESS) {
-            return rv;
+            break;
         }
+        done++;
     }
 
+    /* Atoms written before an error stay written. */
+    reg_range_changed(t, start, done);
     return rv;
 }
 
@@ -1628,12 +2359,18 @@ register_set_from_hexstr(RegisterTable *t, const RegisterAddress start,
  * destination area, depending on which of the two contains the least amount of
  * data.
  *
+ * If the destination area is double-buffered, the data is copied into its
+ * shadow copy, which is then published. Readers see the whole transfer as a
+ * single change.
+ *
  * @param  t       The register table to work within
  * @param  dst    Handle to destination area
  * @param  src    Handle to source area
  *
  * @return Error condition arising from copy process.
- * @sideeffects Source area data is transferred into destination area.
+ * @sideeffects Source area data is transferred into destination area, the
+ *              entries of the destination area are marked dirty, and their
+ *              observers are notified.
  */
 RegisterAccess
 register_mcopy(RegisterTable *t, AreaHandle dst, AreaHandle src)
@@ -1644,21 +2381,113 @@ register_mcopy(RegisterTable *t, AreaHandle dst, AreaHandle src)
         return rv;
     }
 
+    if (dst == src) {
+        return rv;
+    }
+
     RegisterArea *da = &(t->area[dst]);
     RegisterArea *sa = &(t->area[src]);
     const size_t n = (da->size < sa->size) ? da->size : sa->size;
 
-    if ((t->area[dst].mem != NULL) && (t->area[src].mem != NULL)) {
-        /* Both areas are memory backed; just use memcpy */
-        memcpy(da->mem, sa->mem, n * sizeof(RegisterAtom));
-        return rv;
-    } else if (t->area[dst].mem == NULL) {
+    if (t->area[dst].mem == NULL) {
         /* Destination buffer has to be accessed via its block-write API */
-        return da->write(da, sa->mem, 0U, n);
+        rv = da->write(da, sa->mem, 0U, n);
+        if (rv.code == REG_ACCESS_SUCCESS) {
+            reg_range_changed(t, da->base, n);
+        }
+        return rv;
+    }
+
+    RegisterHandle first = 0U, last = 0U;
+    bool published = false;
+    register_area_write_begin(da);
+    RegisterAtom *mem = ra_staging(da);
+    if (t->area[src].mem != NULL) {
+        /* Both areas are memory backed; just use memcpy */
+        RegisterSequence s;
+        do {
+            s = register_area_read_begin(sa);
+            memcpy(mem, sa->mem, n * sizeof(RegisterAtom));
+        } while (register_area_read_retry(sa, s));
     } else {
         /* Source buffer has to be accessed via its block-read API */
-        return sa->read(sa, da->mem, 0U, n);
+        rv = sa->read(sa, mem, 0U, n);
+    }
+    if (rv.code == REG_ACCESS_SUCCESS
+        && BIT_ISSET(da->flags, REG_AF_DOUBLE_BUFFER))
+    {
+        published = ra_publish(t, da, &first, &last);
+    }
+    register_area_write_end(da);
+    if (published) {
+        reg_notify_range(t, first, last);
+    }
+    /* This skips double-buffered areas, that publishing reported already. */
+    reg_range_changed(t, da->base, n);
+    return rv;
+}
+
+/**
+ * Publish the staged contents of a double-buffered area
+ *
+ * Writes to areas with the REG_AF_DOUBLE_BUFFER flag go to a shadow copy of
+ * the area's memory, while reads see the published copy. This swaps the two
+ * copies, so all writes since the last publication become visible at once.
+ * The next write brings the new shadow copy up to date, before modifying it.
+ * If nothing was written since the last publication, this does nothing.
+ *
+ * Staging a write neither marks entries dirty nor notifies observers, since
+ * readers cannot see it yet. Publishing does both, for the entries whose
+ * value it changes.
+ *
+ * Swapping the copies only changes a pointer. Readers that may run
+ * concurrently with writers on other threads need sequence locks (see
+ * register_area_read_begin()), so they do not keep reading from a copy, that
+ * is being staged into.
+ *
+ * @param  t    The register table to work within
+ * @param  ah   Handle of the area to publish
+ *
+ * @return REG_ACCESS_UNINITIALISED if the table isn't initialised;
+ *         REG_ACCESS_NOENTRY if the area handle is out of range, with the
+ *         address field set to the handle;
+ *         REG_ACCESS_INVALID if the area is not double-buffered;
+ *         REG_ACCESS_SUCCESS otherwise.
+ * @sideeffects Makes staged writes to the area visible, marks changed
+ *              entries dirty and notifies their observers.
+ */
+RegisterAccess
+register_area_publish(RegisterTable *t, AreaHandle ah)
+{
+    RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+
+    if (BIT_ISSET(t->flags, REG_TF_INITIALISED) == false) {
+        rv.code = REG_ACCESS_UNINITIALISED;
+        rv.address = ah;
+        return rv;
+    }
+
+    if (ah >= t->areas) {
+        rv.code = REG_ACCESS_NOENTRY;
+        rv.address = ah;
+        return rv;
+    }
+
+    RegisterArea *a = &t->area[ah];
+    if (BIT_ISSET(a->flags, REG_AF_DOUBLE_BUFFER) == false) {
+        rv.code = REG_ACCESS_INVALID;
+        rv.address = a->base;
+        return rv;
+    }
+
+    RegisterHandle first = 0U, last = 0U;
+    register_area_write_begin(a);
+    const bool changed = ra_publish(t, a, &first, &last);
+    register_area_write_end(a);
+    if (changed) {
+        reg_notify_range(t, first, last);
     }
+    return rv;
 }
 
 bool
@@ -1747,24 +2576,23 @@ register_sanitise(RegisterTable *t)
     return rv;
 }
 
-/* Linear search: Simple and likely sufficient with short register tables. We
- * can replace with with bisection if this turns out not to be the case. */
+/* Bisection: Large tables with thousands of entries are common enough for a
+ * linear search to show up in block accesses. */
 
 static struct maybe_area
 find_area(const RegisterTable *t,
           AreaHandle first, AreaHandle last,
           RegisterAddress addr)
 {
-    struct maybe_area rv = { .valid = true, .handle = 0 };
+    struct maybe_area rv = { .valid = false, .handle = 0 };
+    const AreaHandle i = ra_first_ending_after(t, first,
+                                               (AreaHandle)(last + 1U), addr);
 
-    for (AreaHandle i = first; i <= last; i++) {
-        if (ra_addr_is_part_of(t->area + i, addr)) {
-            rv.handle = i;
-            return rv;
-        }
+    if (i <= last && ra_addr_is_part_of(t->area + i, addr)) {
+        rv.valid = true;
+        rv.handle = i;
     }
 
-    rv.valid = false;
     return rv;
 }
 
@@ -1773,16 +2601,14 @@ find_reg(const RegisterTable *t,
          RegisterHandle first, RegisterHandle last,
          RegisterAddress addr)
 {
-    struct maybe_register rv = { .valid = true, .handle = 0 };
+    struct maybe_register rv = { .valid = false, .handle = 0 };
+    const RegisterHandle i = reg_first_ending_after(t, first, last + 1U, addr);
 
-    for (RegisterHandle i = first; i <= last; i++) {
-        if (reg_range_touches(t->entry + i, addr, 1U) == 0) {
-            rv.handle = i;
-            return rv;
-        }
+    if (i <= last && reg_range_touches(t, i, addr, 1U) == 0) {
+        rv.valid = true;
+        rv.handle = i;
     }
 
-    rv.valid = false;
     return rv;
 }
 
@@ -1794,7 +2620,7 @@ reg_iterate(RegisterTable *t,
     RegisterAccess rv = { .code = REG_ACCESS_SUCCESS, .address = 0U };
     RegisterHandle last = t->entries - 1U;
 
-    while (start <= last && t->entry[start].address <= end) {
+    while (start <= last && reg_entry_address(t, start) <= end) {
         int iret = f(t, start, arg);
 
         if (LIKELY(iret == 0)) {
@@ -1881,6 +2707,358 @@ register_foreach_in(RegisterTable *t,
     return reg_iterate(t, startreg.handle, addr + off - 1U, f, arg);
 }
 
+/**
+ * Take a snapshot of a table's dirty map and clear it
+ *
+ * The destination needs room for REGISTER_DIRTY_WORDS(t->entries) words. If
+ * it is smaller, only the first ‘words’ words of the map are taken and
+ * cleared. If the table has no dirty map, the destination is cleared.
+ *
+ * @param  t       The register table to work with
+ * @param  dst     Memory to copy the dirty map to
+ * @param  words   Number of words available at dst
+ *
+ * @return The table's epoch at the time of the snapshot.
+ * @sideeffects Modifies memory at dst; clears the table's dirty map.
+ */
+uint32_t
+register_dirty_snapshot(RegisterTable *t, RegisterDirtyWord *dst,
+                        const size_t words)
+{
+    const size_t used = REGISTER_DIRTY_WORDS(t->entries);
+    const size_t n = reg_min(reg_min(words, used), t->dirty.words);
+
+    if (t->dirty.map == NULL) {
+        memset(dst, 0, words * sizeof(RegisterDirtyWord));
+        return t->dirty.epoch;
+    }
+
+    for (size_t i = 0U; i < n; ++i) {
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+        /* Bits set by concurrent writers are either taken or kept. */
+        dst[i] = atomic_exchange_explicit(&t->dirty.map[i], 0U,
+                                          memory_order_acquire);
+#else
+        dst[i] = t->dirty.map[i];
+        t->dirty.map[i] = 0U;
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+    }
+    if (words > n) {
+        memset(dst + n, 0, (words - n) * sizeof(RegisterDirtyWord));
+    }
+    return t->dirty.epoch;
+}
+
+/**
+ * Set up an iterator over the bits set in a dirty map
+ *
+ * The map is usually a snapshot taken by register_dirty_snapshot().
+ *
+ * @param  it      The iterator to initialise
+ * @param  map     The dirty map to iterate over
+ * @param  words   Number of words in the map
+ *
+ * @sideeffects Initialises *it.
+ */
+void
+register_dirty_iter(RegisterDirtyIter *it, const RegisterDirtyWord *map,
+                    const size_t words)
+{
+    it->map = map;
+    it->words = words;
+    it->word = 0U;
+    it->bits = (words > 0U) ? map[0] : 0U;
+}
+
+static inline unsigned int
+reg_ctz(RegisterDirtyWord w)
+{
+#ifdef HAVE_COMPILER_BUILTIN_CTZL
+    return (unsigned int)__builtin_ctzl((unsigned long)w);
+#else
+    unsigned int n = 0U;
+    while ((w & 1U) == 0U) {
+        w >>= 1U;
+        n++;
+    }
+    return n;
+#endif /* HAVE_COMPILER_BUILTIN_CTZL */
+}
+
+/**
+ * Return the next dirty register of an iteration
+ *
+ * Words without any bits set are skipped as a whole, and within a word each
+ * set bit is found by counting trailing zeros. Thus, iterating a map costs
+ * one step per changed register, plus one per word of the map.
+ *
+ * @param  it      The iterator to advance
+ * @param  reg     Where to store the handle of the next dirty register
+ *
+ * @return true if a register was stored in reg; false if there are no more
+ *         dirty registers.
+ * @sideeffects Advances the iterator.
+ */
+bool
+register_dirty_next(RegisterDirtyIter *it, RegisterHandle *reg)
+{
+    while (it->bits == 0U) {
+        it->word++;
+        if (it->word >= it->words) {
+            it->word = it->words;
+            return false;
+        }
+        it->bits = it->map[it->word];
+    }
+
+    const unsigned int bit = reg_ctz(it->bits);
+    /* Clear the lowest set bit */
+    it->bits &= it->bits - 1U;
+    *reg = (RegisterHandle)(it->word * REGISTER_DIRTY_BITS + bit);
+    return true;
+}
+
+/*
+ * Write observers
+ */
+
+static inline uint32_t
+reg_critical_enter(RegisterTable *t)
+{
+    return (t->critical.enter != NULL) ? t->critical.enter() : 0U;
+}
+
+static inline void
+reg_critical_leave(RegisterTable *t, uint32_t state)
+{
+    if (t->critical.leave != NULL) {
+        t->critical.leave(state);
+    }
+}
+
+static void
+reg_notify_queue(RegisterTable *t, size_t observer,
+                 RegisterHandle first, RegisterHandle last)
+{
+    RegisterNotifyQueue *q = &t->observers.queue;
+    const uint32_t state = reg_critical_enter(t);
+
+    if (q->head != q->tail) {
+        RegisterNotification *n = &q->slot[(q->head - 1U) % q->size];
+        /* Coalesce with the newest notification, if the ranges overlap or
+         * are adjacent. */
+        if (n->observer == observer
+            && first <= n->last + 1U && n->first <= last + 1U)
+        {
+            n->first = (first < n->first) ? first : n->first;
+            n->last = (last > n->last) ? last : n->last;
+            reg_critical_leave(t, state);
+            return;
+        }
+    }
+
+    if (q->head - q->tail >= q->size) {
+        q->lost++;
+    } else {
+        q->slot[q->head % q->size] = (RegisterNotification) {
+            .observer = observer, .first = first, .last = last };
+        q->head++;
+    }
+    reg_critical_leave(t, state);
+}
+
+/* Changes to double-buffered areas are reported when they are published, see
+ * ra_publish(). These skip entries in such areas. */
+static bool
+reg_reports_on_publish(const RegisterTable *t, RegisterHandle reg)
+{
+    return BIT_ISSET(t->entry[reg].area->flags, REG_AF_DOUBLE_BUFFER);
+}
+
+static void
+reg_mark_dirty(RegisterTable *t, RegisterHandle reg)
+{
+    if (reg_reports_on_publish(t, reg) == false) {
+        register_mark_dirty(t, reg);
+    }
+}
+
+/* Report a change of n atoms at addr, that did not go through the entries
+ * themselves: Mark every entry, that overlaps the range, dirty, and notify
+ * observers of them at once. */
+static void
+reg_range_changed(RegisterTable *t, RegisterAddress addr, RegisterOffset n)
+{
+    const RegisterAddress end = addr + n;
+    const RegisterHandle first = reg_first_ending_after(t, 0UL, t->entries,
+                                                        addr);
+    RegisterHandle i = first;
+    for (; i < t->entries && reg_entry_address(t, i) < end; ++i) {
+        reg_mark_dirty(t, i);
+    }
+    if (i > first) {
+        reg_notify(t, first, i - 1U);
+    }
+}
+
+static void
+reg_notify(RegisterTable *t, RegisterHandle first, RegisterHandle last)
+{
+    RegisterHandle lo = first;
+    for (;;) {
+        while (lo < last && reg_reports_on_publish(t, lo)) {
+            lo++;
+        }
+        if (reg_reports_on_publish(t, lo)) {
+            return;
+        }
+        RegisterHandle hi = lo;
+        while (hi < last && reg_reports_on_publish(t, hi + 1U) == false) {
+            hi++;
+        }
+        reg_notify_range(t, lo, hi);
+        if (hi == last) {
+            return;
+        }
+        lo = hi + 1U;
+    }
+}
+
+static void
+reg_notify_range(RegisterTable *t, RegisterHandle first, RegisterHandle last)
+{
+    for (size_t i = 0U; i < t->observers.count; ++i) {
+        const RegisterObserver *o = &t->observers.observer[i];
+        const RegisterHandle lo = (first > o->first) ? first : o->first;
+        const RegisterHandle hi = (last < o->last) ? last : o->last;
+        if (lo > hi) {
+            continue;
+        }
+        if (o->mode == REG_NOTIFY_DEFERRED) {
+            reg_notify_queue(t, i, lo, hi);
+        } else {
+            o->cb(t, lo, hi, o->arg);
+        }
+    }
+}
+
+static void
+reg_notify_handles(RegisterTable *t, const RegisterHandle *h, size_t n)
+{
+    size_t i = 0U;
+    while (i < n) {
+        /* Notify runs of consecutive handles at once. */
+        size_t k = 1U;
+        while (i + k < n && h[i + k] == h[i + k - 1U] + 1U) {
+            k++;
+        }
+        reg_notify(t, h[i], h[i + k - 1U]);
+        i += k;
+    }
+}
+
+/**
+ * Register an observer for a range of registers
+ *
+ * The callback is called with the table, the first and last handle of the
+ * changed registers within the observed range, and arg. Immediate observers
+ * are called right after a write; deferred observers are called from
+ * register_notify_drain(). The table needs slots for observers (see
+ * REGISTER_OBSERVERS()), and register_init() removes all observers. Deferred
+ * observers need a notification queue and the table's critical section hooks,
+ * which guard the queue between the writer and register_notify_drain().
+ *
+ * @param  t      The register table to work with
+ * @param  first  Handle of the first register to observe
+ * @param  last   Handle of the last register to observe
+ * @param  cb     The callback to notify
+ * @param  arg    Argument to pass to the callback
+ * @param  mode   REG_NOTIFY_IMMEDIATE or REG_NOTIFY_DEFERRED
+ *
+ * @return REG_ACCESS_UNINITIALISED if the table isn't initialised;
+ *         REG_ACCESS_NOENTRY if the handle range is empty or out of range,
+ *         with the address field set to the last handle;
+ *         REG_ACCESS_INVALID if there is no callback or no free slot, or
+ *         if a deferred observer lacks a queue or critical section hooks;
+ *         REG_ACCESS_SUCCESS otherwise.
+ * @sideeffects Adds an observer to the table.
+ */
+RegisterAccess
+register_observe(RegisterTable *t, RegisterHandle first, RegisterHandle last,
+                 registerObserverCallback cb, void *arg,
+                 RegisterNotifyMode mode)
+{
+    RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+    RegisterObservers *os = &t->observers;
+
+    if (BIT_ISSET(t->flags, REG_TF_INITIALISED) == false) {
+        rv.code = REG_ACCESS_UNINITIALISED;
+        rv.address = last;
+        return rv;
+    }
+
+    if (first > last || last >= t->entries) {
+        rv.code = REG_ACCESS_NOENTRY;
+        rv.address = last;
+        return rv;
+    }
+
+    if (cb == NULL || os->count >= os->slots
+        || (mode == REG_NOTIFY_DEFERRED
+            && (os->queue.size == 0U
+                || t->critical.enter == NULL
+                || t->critical.leave == NULL)))
+    {
+        rv.code = REG_ACCESS_INVALID;
+        rv.address = last;
+        return rv;
+    }
+
+    os->observer[os->count] = (RegisterObserver) {
+        .first = first, .last = last, .cb = cb, .arg = arg, .mode = mode };
+    os->count++;
+    return rv;
+}
+
+/**
+ * Deliver queued notifications to deferred observers
+ *
+ * This is meant to be called from a worker, that runs separately from the
+ * context that writes to the table. Notifications are taken from the queue
+ * within the table's critical section hooks, and the observers are called
+ * outside of them.
+ *
+ * @param  t      The register table to work with
+ * @param  max    Maximum number of notifications to deliver
+ *
+ * @return The number of notifications delivered.
+ * @sideeffects Calls deferred observers; removes notifications from the
+ *              table's queue.
+ */
+size_t
+register_notify_drain(RegisterTable *t, const size_t max)
+{
+    RegisterNotifyQueue *q = &t->observers.queue;
+    size_t done = 0U;
+
+    while (done < max) {
+        const uint32_t state = reg_critical_enter(t);
+        if (q->head == q->tail) {
+            reg_critical_leave(t, state);
+            break;
+        }
+        const RegisterNotification n = q->slot[q->tail % q->size];
+        q->tail++;
+        reg_critical_leave(t, state);
+
+        const RegisterObserver *o = &t->observers.observer[n.observer];
+        o->cb(t, n.first, n.last, o->arg);
+        done++;
+    }
+
+    return done;
+}
+
 RegisterEntry *
 register_get_entry(const RegisterTable *t, const RegisterHandle r)
 {
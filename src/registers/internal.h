@@ -23,8 +23,8 @@
 extern "C" {
 #endif /* __cplusplus */
 
-#define REG_INIT_CODE_MAXIDX REG_INIT_ENTRY_INVALID_DEFAULT
-#define REG_ACCESS_CODE_MAXIDX REG_ACCESS_READONLY
+#define REG_INIT_CODE_MAXIDX REG_INIT_ENTRY_IMAGE_MISMATCH
+#define REG_ACCESS_CODE_MAXIDX REG_ACCESS_MISMATCH
 #define REG_TYPE_MAXIDX REG_TYPE_FLOAT64
 #define REGV_TYPE_MAXIDX REGV_TYPE_CALLBACK
 
@@ -266,6 +266,26 @@ register_init_print(void *fh, const char *prefix, const RegisterInit result)
         r_fprintf(fh, "%sFirst offending entry: %" PRIu32 "!\n", prefix,
                   result.pos.entry);
         break;
+    case REG_INIT_DIRTY_MAP_TOO_SMALL:
+        r_fprintf(fh, "%sDirty map has fewer bits than the table has entries!\n",
+                  prefix);
+        break;
+    case REG_INIT_AREA_NO_SHADOW:
+        r_fprintf(fh, "%sDouble-buffered area lacks memory or shadow!\n",
+                  prefix);
+        r_fprintf(fh, "%sFirst offending area: %" PRIu16 "!\n", prefix,
+                  result.pos.area);
+        break;
+    case REG_INIT_INDEX_TOO_SMALL:
+        r_fprintf(fh, "%sEntry index is smaller than the table!\n",
+                  prefix);
+        break;
+    case REG_INIT_ENTRY_IMAGE_MISMATCH:
+        r_fprintf(fh, "%sDefault image disagrees with entry's default value!\n",
+                  prefix);
+        r_fprintf(fh, "%sFirst offending entry: %" PRIu32 "!\n", prefix,
+                  result.pos.entry);
+        break;
     case REG_INIT_SUCCESS:
         r_fprintf(fh, "%sRegister Table Initialisation Successful!\n", prefix);
         break;
@@ -291,7 +311,8 @@ register_accesscode_to_string(RegisterAccessCode code)
         IDX2STR(REG_ACCESS_RANGE),
         IDX2STR(REG_ACCESS_INVALID),
         IDX2STR(REG_ACCESS_READONLY),
-        IDX2STR(REG_ACCESS_IO_ERROR)
+        IDX2STR(REG_ACCESS_IO_ERROR),
+        IDX2STR(REG_ACCESS_MISMATCH)
     };
 
     return map[code];
@@ -315,7 +336,11 @@ register_initcode_to_string(RegisterInitCode code)
         IDX2STR(REG_INIT_ENTRY_INVALID_ORDER),
         IDX2STR(REG_INIT_ENTRY_ADDRESS_OVERLAP),
         IDX2STR(REG_INIT_ENTRY_IN_MEMORY_HOLE),
-        IDX2STR(REG_INIT_ENTRY_INVALID_DEFAULT)
+        IDX2STR(REG_INIT_ENTRY_INVALID_DEFAULT),
+        IDX2STR(REG_INIT_DIRTY_MAP_TOO_SMALL),
+        IDX2STR(REG_INIT_AREA_NO_SHADOW),
+        IDX2STR(REG_INIT_INDEX_TOO_SMALL),
+        IDX2STR(REG_INIT_ENTRY_IMAGE_MISMATCH)
     };
 
     return map[code];
@@ -14,11 +14,26 @@
  * @}
  */
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif /* __SSE2__ */
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif /* __AVX2__ */
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif /* __ARM_NEON && __aarch64__ */
 
 #include <ufw/compat/errno.h>
+#include <ufw/compat/ssize-t.h>
 
 #include <ufw/bit-operations.h>
+#include <ufw/byte-buffer.h>
 #include <ufw/compiler.h>
 #include <ufw/endpoints.h>
 #include <ufw/rfc1055.h>
@@ -105,21 +120,182 @@ rfc1055_close(Sink *sink)
     return rc < 0 ? rc : 0;
 }
 
+/**
+ * Size of the scratch memory used by rfc1055_encode()
+ *
+ * With octet sources, the encoder produces its output into memory reserved in
+ * the sink, if the sink supports that, and into scratch memory of this size on
+ * the stack otherwise. With all other sources, input data is read into scratch
+ * memory of this size, unless the source offers memory of its own.
+ */
+#define RFC1055_ENCODE_SCRATCH 64U
+
 static const unsigned char esc_esc[2] = { RAW_ESC, ESC_ESC };
 static const unsigned char esc_eof[2] = { RAW_ESC, ESC_EOF };
 
-static inline int
-rfc1055_encode_octet(Sink *sink, unsigned char data)
+/*
+ * Scanning for control characters a word at a time
+ *
+ * Payload usually contains few control characters, if any. So instead of
+ * looking at every octet in turn, the bulk encoder scans for the next control
+ * character in larger steps: With SIMD extensions that are available at
+ * compile time, that is 32 (AVX2) or 16 (SSE2, NEON) octets at a time. On all
+ * other targets a word in a general purpose register is used (SWAR: SIMD
+ * within a register). Once a step finds a control character, its exact
+ * position is determined by looking at the octets of that step one by one.
+ */
+
+#if UINTPTR_MAX > UINT32_MAX
+typedef uint64_t swar_word;
+#define SWAR_ONES UINT64_C(0x0101010101010101)
+#else
+typedef uint32_t swar_word;
+#define SWAR_ONES UINT32_C(0x01010101)
+#endif /* UINTPTR_MAX > UINT32_MAX */
+
+#define SWAR_HIGHS (SWAR_ONES * 0x80U)
+
+/* Non-zero if any octet in v is zero. Bits above the first zero octet may be
+ * set spuriously, which is fine, since only the fact is used here. */
+static inline swar_word
+swar_has_zero(const swar_word v)
 {
-    int rc;
+    return (v - SWAR_ONES) & ~v & SWAR_HIGHS;
+}
 
-    switch (data) {
-    case RAW_ESC: rc = sink_put_chunk(sink, esc_esc, sizeof(esc_esc)); break;
-    case RAW_EOF: rc = sink_put_chunk(sink, esc_eof, sizeof(esc_eof)); break;
-    default:      rc = sink_put_octet(sink, data);                     break;
+static inline bool
+rfc1055_is_special(const unsigned char data)
+{
+    return (data == RAW_EOF || data == RAW_ESC);
+}
+
+static inline size_t
+rfc1055_scan_octets(const unsigned char *p, size_t i, const size_t n)
+{
+    while (i < n && rfc1055_is_special(p[i]) == false) {
+        i++;
     }
+    return i;
+}
 
-    return rc;
+/**
+ * Return the length of the run of plain octets at the start of memory
+ *
+ * @param  p  Pointer to memory to scan
+ * @param  n  Size of the memory pointed to by p
+ *
+ * @return Offset of the first RAW_EOF or RAW_ESC octet in p; n if there is
+ *         none.
+ * @sideeffects None
+ */
+static size_t
+rfc1055_plain_run(const unsigned char *p, const size_t n)
+{
+    size_t i = 0U;
+
+#if defined(__AVX2__)
+    {
+        const __m256i eof = _mm256_set1_epi8((char)RAW_EOF);
+        const __m256i esc = _mm256_set1_epi8((char)RAW_ESC);
+        for (; (i + 32U) <= n; i += 32U) {
+            const __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+            const __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(v, eof),
+                                              _mm256_cmpeq_epi8(v, esc));
+            if (_mm256_movemask_epi8(m) != 0) {
+                return rfc1055_scan_octets(p, i, n);
+            }
+        }
+    }
+#endif /* __AVX2__ */
+
+#if defined(__SSE2__)
+    {
+        const __m128i eof = _mm_set1_epi8((char)RAW_EOF);
+        const __m128i esc = _mm_set1_epi8((char)RAW_ESC);
+        for (; (i + 16U) <= n; i += 16U) {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+            const __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, eof),
+                                           _mm_cmpeq_epi8(v, esc));
+            if (_mm_movemask_epi8(m) != 0) {
+                return rfc1055_scan_octets(p, i, n);
+            }
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    {
+        const uint8x16_t eof = vdupq_n_u8(RAW_EOF);
+        const uint8x16_t esc = vdupq_n_u8(RAW_ESC);
+        for (; (i + 16U) <= n; i += 16U) {
+            const uint8x16_t v = vld1q_u8(p + i);
+            const uint8x16_t m = vorrq_u8(vceqq_u8(v, eof), vceqq_u8(v, esc));
+            if (vmaxvq_u8(m) != 0U) {
+                return rfc1055_scan_octets(p, i, n);
+            }
+        }
+    }
+#endif /* __SSE2__ / __ARM_NEON */
+
+    for (; (i + sizeof(swar_word)) <= n; i += sizeof(swar_word)) {
+        swar_word w;
+        memcpy(&w, p + i, sizeof(w));
+        if ((swar_has_zero(w ^ (SWAR_ONES * RAW_EOF)) |
+             swar_has_zero(w ^ (SWAR_ONES * RAW_ESC))) != 0U)
+        {
+            break;
+        }
+    }
+
+    return rfc1055_scan_octets(p, i, n);
+}
+
+/**
+ * Encode a piece of payload into a sink
+ *
+ * Runs of plain octets are handed to the sink in one go, each control
+ * character is replaced by its escape sequence.
+ *
+ * @param  sink  Pointer to the sink to write to
+ * @param  p     Pointer to the payload memory
+ * @param  n     Size of the payload memory
+ *
+ * @return Negative errno on failure; zero otherwise.
+ * @sideeffects Writes to the sink.
+ */
+static int
+rfc1055_encode_memory(Sink *sink, const unsigned char *p, size_t n)
+{
+    while (n > 0U) {
+        const size_t plain = rfc1055_plain_run(p, n);
+        if (plain > 0U) {
+            const ssize_t rc = sink_put_chunk(sink, p, plain);
+            if (rc < 0) {
+                return (int)rc;
+            }
+        }
+        if (plain == n) {
+            break;
+        }
+
+        const unsigned char *esc = (p[plain] == RAW_ESC) ? esc_esc : esc_eof;
+        const ssize_t rc = sink_put_chunk(sink, esc, 2U);
+        if (rc < 0) {
+            return (int)rc;
+        }
+        p += plain + 1U;
+        n -= plain + 1U;
+    }
+
+    return 0;
+}
+
+static inline size_t
+rfc1055_encode_octet(unsigned char *dst, unsigned char data)
+{
+    switch (data) {
+    case RAW_ESC: dst[0] = RAW_ESC; dst[1] = ESC_ESC; return 2U;
+    case RAW_EOF: dst[0] = RAW_ESC; dst[1] = ESC_EOF; return 2U;
+    default:      dst[0] = data;                      return 1U;
+    }
 }
 
 static inline int
@@ -157,21 +333,139 @@ rfc1055_decode_octet(Source *source, unsigned char *data)
     return rv;
 }
 
-int
-rfc1055_encode(const RFC1055Context *ctx, Source *source, Sink *sink)
+/**
+ * Encode data from an octet source
+ *
+ * Octet sources do not allow reading larger amounts of data at a time, so the
+ * encoder produces its output octet by octet. The output is collected in
+ * memory reserved in the sink, to hand it over in larger chunks.
+ *
+ * @param  source  Pointer to the source to read payload from
+ * @param  sink    Pointer to the sink to write to
+ *
+ * @return Negative errno on failure; zero otherwise.
+ * @sideeffects Reads from source and writes to sink.
+ */
+static int
+rfc1055_encode_octets(Source *source, Sink *sink)
 {
-    MAYBE_RETURN(rfc1055_open(ctx, sink));
+    unsigned char raw[RFC1055_ENCODE_SCRATCH];
+    ByteBuffer scratch;
+    byte_buffer_space(&scratch, raw, sizeof(raw));
+
+    for (bool done = false; done == false;) {
+        /* Every iteration of the inner loop produces at most two octets, so
+         * that is the least amount of memory that is useful here. */
+        void *mem;
+        const ssize_t room = sink_reserve(sink, &scratch, &mem, 2U, SSIZE_MAX);
+        if (room < 0) {
+            return (int)room;
+        }
+
+        unsigned char *dst = mem;
+        size_t n = 0U;
+        int get = 0;
+        while (n + 2U <= (size_t)room) {
+            unsigned char data;
+            get = source_get_octet(source, &data);
+            if (get == -ENODATA || get == 0) {
+                done = true;
+                get = 0;
+                break;
+            } else if (get < 0) {
+                break;
+            }
+            n += rfc1055_encode_octet(dst + n, data);
+        }
+
+        const ssize_t rc = sink_commit(sink, mem, n);
+        if (rc < 0) {
+            return (int)rc;
+        }
+        if (get < 0) {
+            return get;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Encode data from a chunk or vector source
+ *
+ * Data is read in chunks and encoded by rfc1055_encode_memory(). If the
+ * source implements the getbuffer extension, data is read into the memory it
+ * offers, which for sources like buffered sources avoids copying it at all.
+ *
+ * @param  source  Pointer to the source to read payload from
+ * @param  sink    Pointer to the sink to write to
+ *
+ * @return Negative errno on failure; zero otherwise.
+ * @sideeffects Reads from source and writes to sink.
+ */
+static int
+rfc1055_encode_chunks(Source *source, Sink *sink)
+{
+    unsigned char raw[RFC1055_ENCODE_SCRATCH];
+
     for (;;) {
-        unsigned char data;
-        const int get = source_get_octet(source, &data);
+        unsigned char *buf = raw;
+        size_t size = sizeof(raw);
+        if (source->ext.getbuffer != NULL) {
+            ByteBuffer b = source->ext.getbuffer(source);
+            if (byte_buffer_rest(&b) > 0U) {
+                buf = b.data + b.offset;
+                size = byte_buffer_rest(&b);
+            }
+        }
+
+        const ssize_t get = source_read(source, buf, size);
         if (get == -ENODATA || get == 0) {
             break;
         } else if (get < 0) {
-            return get;
+            return (int)get;
         }
-        MAYBE_RETURN(rfc1055_encode_octet(sink, data));
+        MAYBE_RETURN(rfc1055_encode_memory(sink, buf, (size_t)get));
     }
-    return rfc1055_close(sink);
+
+    return 0;
+}
+
+int
+rfc1055_encode(const RFC1055Context *ctx, Source *source, Sink *sink)
+{
+    MAYBE_RETURN(rfc1055_open(ctx, sink));
+    MAYBE_RETURN((source->kind == DATA_KIND_OCTET)
+                 ? rfc1055_encode_octets(source, sink)
+                 : rfc1055_encode_chunks(source, sink));
+    MAYBE_RETURN(rfc1055_close(sink));
+    return sink_end_of_frame(sink);
+}
+
+/**
+ * Encode a frame from memory
+ *
+ * This is the bulk variant of rfc1055_encode(). Runs of octets, that do not
+ * need escaping, are found several octets at a time and handed to the sink in
+ * one go. For payload without control characters, that makes the encoder
+ * perform much like a plain memory copy.
+ *
+ * @param  ctx   Pointer to the RFC1055 context to use
+ * @param  data  Pointer to the payload to encode
+ * @param  n     Size of the payload
+ * @param  sink  Pointer to the sink to write the frame to
+ *
+ * @return Negative errno on failure; zero otherwise.
+ * @sideeffects Writes to the sink.
+ */
+int
+rfc1055_encode_buffer(const RFC1055Context *ctx, const void *data,
+                      const size_t n, Sink *sink)
+{
+    MAYBE_RETURN(rfc1055_open(ctx, sink));
+    MAYBE_RETURN(rfc1055_encode_memory(sink, data, n));
+    MAYBE_RETURN(rfc1055_close(sink));
+    return sink_end_of_frame(sink);
 }
 
 static inline int
@@ -214,7 +508,8 @@ rfc1055_decode(RFC1055Context *ctx, Source *source, Sink *sink)
             }
             break;
         }
-        case RFC1055_NORMAL: /* FALLTHROUGH */
+        case RFC1055_ESCAPED: /* FALLTHROUGH */
+        case RFC1055_NORMAL:  /* FALLTHROUGH */
         default: {
             const int rc = rfc1055_decode_octet(source, &data);
             if (rc == -EILSEQ) {
@@ -246,3 +541,314 @@ rfc1055_decode(RFC1055Context *ctx, Source *source, Sink *sink)
 
     /* NOTREACHED */
 }
+
+/**
+ * Hand a frame to the user of rfc1055_decode_feed()
+ *
+ * @param  frame   Pointer to the frame buffer
+ * @param  status  Status code of the frame
+ * @param  cb      Frame callback to call
+ * @param  arg     Argument for the callback
+ *
+ * @return Return value of the callback.
+ * @sideeffects Resets the frame buffer.
+ */
+static inline int
+rfc1055_deliver(ByteBuffer *frame, const int status,
+                RFC1055FrameCallback cb, void *arg)
+{
+    const int rc = cb(arg, frame, status);
+    byte_buffer_reset(frame);
+    return rc;
+}
+
+/**
+ * State to return to after a frame was terminated by RAW_EOF
+ *
+ * @param  ctx  Pointer to the RFC1055 context in use
+ *
+ * @return The state to continue decoding in.
+ * @sideeffects None
+ */
+static inline int
+rfc1055_after_eof(const RFC1055Context *ctx)
+{
+    return BIT_ISSET(ctx->flags, RFC1055_WITH_SOF)
+        ? RFC1055_SEARCH_FOR_START
+        : RFC1055_NORMAL;
+}
+
+/**
+ * Decode a chunk of SLIP encoded data
+ *
+ * In contrast to rfc1055_decode(), this does not pull data from a source, but
+ * is handed data as it arrives, in pieces of arbitrary size. All state needed
+ * to continue decoding with the next piece, including a pending escape
+ * sequence, is kept in the context. This makes the decoder usable with
+ * non-blocking I/O and event loops.
+ *
+ * Decoded data is collected in the frame buffer. Runs of octets that need no
+ * unescaping are found several octets at a time and copied in one go. When a
+ * frame is complete, or an error is detected, the frame is handed to the
+ * callback, after which the frame buffer is reset. Error recovery works like
+ * it does with rfc1055_decode().
+ *
+ * The frame buffer may share memory with the input, as long as the input does
+ * not start before the frame buffer's write pointer: Decoded data is never
+ * longer than its encoded form, so decoding in place is safe. A typical use
+ * is to receive data right into byte_buffer_writeptr(frame) and then to feed
+ * that memory to the decoder.
+ *
+ * @param  ctx    Pointer to the RFC1055 context to use
+ * @param  in     Pointer to encoded data
+ * @param  n      Size of the encoded data
+ * @param  frame  Pointer to the buffer to decode frames into
+ * @param  cb     Callback to hand frames to
+ * @param  arg    Argument handed to the callback
+ *
+ * @return Negative value returned by the callback, which stops decoding
+ *         after the frame in question; the amount of data consumed (n)
+ *         otherwise.
+ * @sideeffects Modifies ctx and frame; calls cb.
+ */
+ssize_t
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+rfc1055_decode_feed(RFC1055Context *ctx, const void *in, const size_t n,
+                    ByteBuffer *frame, RFC1055FrameCallback cb, void *arg)
+{
+    if (n > SSIZE_MAX) {
+        return -EINVAL;
+    }
+
+    const unsigned char *p = in;
+    size_t rest = n;
+
+    while (rest > 0U) {
+        switch (ctx->state) {
+        case RFC1055_SEARCH_FOR_START: {
+            const unsigned char data = *p++;
+            rest--;
+            if (data == RAW_EOF) {
+                ctx->state = RFC1055_NORMAL;
+            } else {
+                ctx->state = RFC1055_SEARCH_FOR_END;
+                MAYBE_RETURN(rfc1055_deliver(frame, -EILSEQ, cb, arg));
+            }
+            break;
+        }
+        case RFC1055_SEARCH_FOR_END: {
+            const unsigned char *eof = memchr(p, RAW_EOF, rest);
+            if (eof == NULL) {
+                rest = 0U;
+                break;
+            }
+            rest -= (size_t)(eof - p) + 1U;
+            p = eof + 1;
+            ctx->state = rfc1055_after_eof(ctx);
+            break;
+        }
+        case RFC1055_ESCAPED: {
+            const unsigned char data = *p++;
+            rest--;
+            unsigned char decoded;
+            switch (data) {
+            case ESC_EOF: decoded = RAW_EOF; break;
+            case ESC_ESC: decoded = RAW_ESC; break;
+            default:
+                ctx->state = (data == RAW_EOF)
+                    ? rfc1055_after_eof(ctx)
+                    : RFC1055_SEARCH_FOR_END;
+                MAYBE_RETURN(rfc1055_deliver(frame, -EILSEQ, cb, arg));
+                continue;
+            }
+            if (byte_buffer_avail(frame) == 0U) {
+                ctx->state = RFC1055_SEARCH_FOR_END;
+                MAYBE_RETURN(rfc1055_deliver(frame, -ENOBUFS, cb, arg));
+                break;
+            }
+            frame->data[frame->used++] = decoded;
+            ctx->state = RFC1055_NORMAL;
+            break;
+        }
+        case RFC1055_NORMAL: /* FALLTHROUGH */
+        default: {
+            const size_t plain = rfc1055_plain_run(p, rest);
+            if (plain > byte_buffer_avail(frame)) {
+                p += plain;
+                rest -= plain;
+                ctx->state = RFC1055_SEARCH_FOR_END;
+                MAYBE_RETURN(rfc1055_deliver(frame, -ENOBUFS, cb, arg));
+                break;
+            }
+            unsigned char *dst = byte_buffer_writeptr(frame);
+            if (dst != p) {
+                memmove(dst, p, plain);
+            }
+            frame->used += plain;
+            p += plain;
+            rest -= plain;
+            if (rest == 0U) {
+                break;
+            }
+
+            const unsigned char data = *p++;
+            rest--;
+            if (data == RAW_ESC) {
+                ctx->state = RFC1055_ESCAPED;
+            } else {
+                ctx->state = rfc1055_after_eof(ctx);
+                MAYBE_RETURN(rfc1055_deliver(frame, 0, cb, arg));
+            }
+            break;
+        }
+        }
+    }
+
+    return (ssize_t)n;
+}
+
+/**
+ * Unescape a complete frame in place
+ *
+ * The encoded frame must not contain RAW_EOF. Decoding stops at the first
+ * invalid escape sequence, which drops the rest of the frame, just like
+ * rfc1055_decode() does while resynchronising.
+ *
+ * @param  b      Pointer to the buffer holding the frame
+ * @param  in     Offset of the encoded frame in b
+ * @param  end    Offset of the end of the encoded frame in b
+ * @param  out    Pointer to the offset to decode to; this is advanced by the
+ *                amount of data decoded
+ *
+ * @return Zero on success; -EILSEQ for invalid escape sequences.
+ * @sideeffects Modifies b and out.
+ */
+static int
+rfc1055_unescape(unsigned char *b, size_t in, const size_t end, size_t *out)
+{
+    size_t o = *out;
+    int rv = 0;
+
+    while (in < end) {
+        const size_t plain = rfc1055_plain_run(b + in, end - in);
+        if (o != in) {
+            memmove(b + o, b + in, plain);
+        }
+        o += plain;
+        in += plain;
+        if (in == end) {
+            break;
+        }
+
+        /* Without RAW_EOF in the frame, this is RAW_ESC. One right before
+         * the end of the frame is followed by RAW_EOF, which is invalid. */
+        const unsigned char second = (in + 1U < end) ? b[in + 1U] : RAW_EOF;
+        if (second == ESC_EOF) {
+            b[o++] = RAW_EOF;
+        } else if (second == ESC_ESC) {
+            b[o++] = RAW_ESC;
+        } else {
+            rv = -EILSEQ;
+            break;
+        }
+        in += 2U;
+    }
+
+    *out = o;
+    return rv;
+}
+
+/**
+ * Extract all complete frames from a buffer of SLIP encoded data
+ *
+ * This scans a large buffer, like the result of a single read from a serial
+ * device, for frames in one go. Each frame found is decoded in place and
+ * described by an entry in the span array. Decoded frames are packed towards
+ * the start of the buffer, so they never overlap with encoded data that was
+ * not consumed.
+ *
+ * Frames, that are not terminated within the buffer, are not consumed and left
+ * untouched. Neither is any data after the span array was filled up. Callers
+ * should move the data starting at the consumed offset to the start of their
+ * buffer, before appending more data and calling this function again, with
+ * the same context. Data consumed while resynchronising (see below) is never
+ * left in the buffer.
+ *
+ * Resynchronisation follows the same rules as rfc1055_decode(), including the
+ * RFC1055_WITH_SOF variant. The context must not be used with
+ * rfc1055_decode_feed() at the same time.
+ *
+ * @param  ctx       Pointer to the RFC1055 context to use
+ * @param  buf       Pointer to the buffer holding encoded data
+ * @param  n         Amount of encoded data in buf
+ * @param  span      Pointer to an array of frame descriptions
+ * @param  spans     Number of elements in the span array
+ * @param  consumed  Pointer to return the amount of consumed data through
+ *
+ * @return Negative errno on failure; the number of frames found otherwise.
+ * @sideeffects Modifies ctx, buf, span and consumed.
+ */
+ssize_t
+/* NOLINTNEXTLINE(readability-function-cognitive-complexity) */
+rfc1055_decode_frames(RFC1055Context *ctx, void *buf, const size_t n,
+                      RFC1055Span *span, const size_t spans,
+                      size_t *consumed)
+{
+    if (n > SSIZE_MAX || spans > SSIZE_MAX) {
+        return -EINVAL;
+    }
+
+    unsigned char *b = buf;
+    size_t in = 0U;
+    size_t out = 0U;
+    size_t count = 0U;
+
+    while (in < n && count < spans) {
+        switch (ctx->state) {
+        case RFC1055_SEARCH_FOR_START:
+            if (b[in++] == RAW_EOF) {
+                ctx->state = RFC1055_NORMAL;
+            } else {
+                ctx->state = RFC1055_SEARCH_FOR_END;
+                span[count].offset = out;
+                span[count].length = 0U;
+                span[count].status = -EILSEQ;
+                count++;
+            }
+            break;
+        case RFC1055_SEARCH_FOR_END: {
+            const unsigned char *eof = memchr(b + in, RAW_EOF, n - in);
+            if (eof == NULL) {
+                in = n;
+                break;
+            }
+            in = (size_t)(eof - b) + 1U;
+            ctx->state = rfc1055_after_eof(ctx);
+            break;
+        }
+        /* Frames are always decoded as a whole here, so an escape sequence
+         * cannot be pending. */
+        case RFC1055_ESCAPED: /* FALLTHROUGH */
+        case RFC1055_NORMAL:  /* FALLTHROUGH */
+        default: {
+            const unsigned char *eof = memchr(b + in, RAW_EOF, n - in);
+            if (eof == NULL) {
+                /* Incomplete frame; leave it for the next call. */
+                goto done;
+            }
+            const size_t end = (size_t)(eof - b);
+            span[count].offset = out;
+            span[count].status = rfc1055_unescape(b, in, end, &out);
+            span[count].length = out - span[count].offset;
+            count++;
+            in = end + 1U;
+            ctx->state = rfc1055_after_eof(ctx);
+            break;
+        }
+        }
+    }
+
+done:
+    *consumed = in;
+    return (ssize_t)count;
+}
@@ -15,9 +15,11 @@
  */
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include <ufw/compat/errno.h>
+#include <ufw/compat/ssize-t.h>
 
 #include <ufw/byte-buffer.h>
 #include <ufw/endpoints.h>
@@ -222,15 +224,48 @@ varint_s64_from_source(Source *source, int64_t *n)
     return rc;
 }
 
+/**
+ * Prepare memory to encode a variable length integer into for a sink
+ *
+ * This uses sink_reserve(), so that integers are encoded directly into the
+ * sink's memory if it supports that. The caller's raw memory is used as a
+ * fallback otherwise.
+ *
+ * @param  sink  Pointer to the sink instance the integer is meant for
+ * @param  buf   Pointer to the byte buffer to set up for encoding
+ * @param  raw   Pointer to scratch memory of at least "size" octets
+ * @param  size  Maximum size of the encoded integer
+ *
+ * @return Negative errno on failure; zero otherwise.
+ * @sideeffects Initialises buf; see sink_reserve() for more.
+ */
+static int
+varint_reserve(Sink *sink, ByteBuffer *buf, unsigned char *raw, size_t size)
+{
+    ByteBuffer scratch;
+    void *mem;
+
+    byte_buffer_space(&scratch, raw, size);
+    const ssize_t rc = sink_reserve(sink, &scratch, &mem, size, size);
+    if (rc < 0) {
+        return (int)rc;
+    }
+    byte_buffer_space(buf, mem, (size_t)rc);
+    return 0;
+}
+
 int
 varint_u32_to_sink(Sink *sink, const uint32_t n)
 {
     unsigned char raw[VARINT_32BIT_MAX_OCTETS];
     ByteBuffer buf;
 
-    byte_buffer_space(&buf, raw, VARINT_32BIT_MAX_OCTETS);
+    const int rc = varint_reserve(sink, &buf, raw, VARINT_32BIT_MAX_OCTETS);
+    if (rc < 0) {
+        return rc;
+    }
     varint_encode_u32(&buf, n);
-    return sink_put_chunk(sink, buf.data, buf.used);
+    return sink_commit(sink, buf.data, buf.used);
 }
 
 int
@@ -239,9 +274,12 @@ varint_s32_to_sink(Sink *sink, const int32_t n)
     unsigned char raw[VARINT_32BIT_MAX_OCTETS];
     ByteBuffer buf;
 
-    byte_buffer_space(&buf, raw, VARINT_32BIT_MAX_OCTETS);
+    const int rc = varint_reserve(sink, &buf, raw, VARINT_32BIT_MAX_OCTETS);
+    if (rc < 0) {
+        return rc;
+    }
     varint_encode_s32(&buf, n);
-    return sink_put_chunk(sink, buf.data, buf.used);
+    return sink_commit(sink, buf.data, buf.used);
 }
 
 int
@@ -250,9 +288,12 @@ varint_u64_to_sink(Sink *sink, const uint64_t n)
     unsigned char raw[VARINT_64BIT_MAX_OCTETS];
     ByteBuffer buf;
 
-    byte_buffer_space(&buf, raw, VARINT_64BIT_MAX_OCTETS);
+    const int rc = varint_reserve(sink, &buf, raw, VARINT_64BIT_MAX_OCTETS);
+    if (rc < 0) {
+        return rc;
+    }
     varint_encode_u64(&buf, n);
-    return sink_put_chunk(sink, buf.data, buf.used);
+    return sink_commit(sink, buf.data, buf.used);
 }
 
 int
@@ -261,9 +302,12 @@ varint_s64_to_sink(Sink *sink, const int64_t n)
     unsigned char raw[VARINT_64BIT_MAX_OCTETS];
     ByteBuffer buf;
 
-    byte_buffer_space(&buf, raw, VARINT_64BIT_MAX_OCTETS);
+    const int rc = varint_reserve(sink, &buf, raw, VARINT_64BIT_MAX_OCTETS);
+    if (rc < 0) {
+        return rc;
+    }
     varint_encode_s64(&buf, n);
-    return sink_put_chunk(sink, buf.data, buf.used);
+    return sink_commit(sink, buf.data, buf.used);
 }
 
 size_t
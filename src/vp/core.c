@@ -252,14 +252,32 @@ vp_store(VersionedPersistence *vp, const void *src,
     if ((offset + n) > get_length(vp)) {
         return -EFAULT;
     }
-    const size_t start = vp->data.address + VP_SIZE_META + offset;
-    maybe(sink_seek(&vp->data.sink, start));
-    /* This sink_put_chunk() doesn't use "maybe", because we want to return the
-     * positive value from it as our own return value. */
-    ssize_t rc = sink_put_chunk(&vp->data.sink, src, n);
+    /* When the whole payload is replaced, its checksum is computed while it
+     * is written. Otherwise, if the payload checksum in the meta data block is
+     * known to be correct, it can be updated from the part of the payload
+     * that is replaced, if the checksum implementation supports it. That needs
+     * the previous content of the part, so it is read before writing. */
+    const bool whole = (offset == 0U) && (n == get_length(vp));
+    const bool incremental = (whole == false) && (vp->chksum.zeros != NULL)
+        && BIT_ISSET(vp->state, VP_STATE_PAYLOAD_CONSISTENT);
+    vp_chksum prev = 0U;
+    if (incremental) {
+        maybe(vp_calculate_part_checksum(vp, offset, n, &prev));
+    }
+    vp_chksum sum = whole ? vp->chksum.initial : 0U;
+    /* This doesn't use "maybe", because we want to return the positive value
+     * from it as our own return value. */
+    ssize_t rc = vp_store_payload(vp, src, offset, n,
+                                  (whole || incremental) ? &sum : NULL);
     if (rc >= 0) {
         /* Therefore this is the successful branch. */
-        maybe(vp_update_meta(vp));
+        if (whole) {
+            vp->result.payload = sum;
+        } else if (incremental) {
+            vp_calculate_payload_delta(vp, prev ^ sum, offset, n);
+        }
+        maybe((whole || incremental) ? vp_update_meta_incremental(vp)
+                                     : vp_update_meta(vp));
     }
     /* …and this is error handling. */
     return rc;
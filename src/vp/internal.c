@@ -36,28 +36,29 @@ vp_calculate_header_checksum(VersionedPersistence *vp)
 }
 
 /**
- * Update payload checksum result
- *
- * The updated datum is stored in `vp->result.payload`.
+ * Update checksum with part of the payload in storage
  *
  * Since this function has to interact with the memory peripheral used for
- * storage, errors are possible. Therefore the functions return type is int, in
- * contrast to `void` in case of calculate_header_checksum().
+ * storage, errors are possible.
  *
- * @param  vp  VersionedPersistence instance to update
- * @param  n   Length of data to consider for the checksum calculation.
+ * @param  vp      VersionedPersistence instance to use
+ * @param  offset  Offset of the part in the payload
+ * @param  n       Length of the part
+ * @param  sum     Pointer to the checksum to update
  *
  * @return Zero if no errors occured; negative errno otherwise.
- * @sideeffects Modifies vp->result.
+ * @sideeffects Modifies *sum.
  */
 int
-vp_calculate_payload_checksum(VersionedPersistence *vp, const size_t n)
+vp_calculate_part_checksum(VersionedPersistence *vp, const size_t offset,
+                           const size_t n, vp_chksum *sum)
 {
     unsigned char buf[16];
     size_t rest = n;
 
-    maybe(source_seek(&vp->data.source, vp->data.address + VP_SIZE_META));
-    vp_chksum cs = vp->chksum.initial;
+    maybe(source_seek(&vp->data.source,
+                      vp->data.address + VP_SIZE_META + offset));
+    vp_chksum cs = *sum;
     while (rest > 0U) {
         const size_t toread = rest > sizeof(buf) ? sizeof(buf) : rest;
         const ssize_t m = source_get_chunk(&vp->data.source, buf, toread);
@@ -68,10 +69,105 @@ vp_calculate_payload_checksum(VersionedPersistence *vp, const size_t n)
         cs = vp->chksum.process(cs, buf, m);
     }
 
+    *sum = cs;
+    return 0;
+}
+
+/**
+ * Update payload checksum result
+ *
+ * The updated datum is stored in `vp->result.payload`.
+ *
+ * Since this function has to interact with the memory peripheral used for
+ * storage, errors are possible. Therefore the functions return type is int, in
+ * contrast to `void` in case of calculate_header_checksum().
+ *
+ * @param  vp  VersionedPersistence instance to update
+ * @param  n   Length of data to consider for the checksum calculation.
+ *
+ * @return Zero if no errors occured; negative errno otherwise.
+ * @sideeffects Modifies vp->result.
+ */
+int
+vp_calculate_payload_checksum(VersionedPersistence *vp, const size_t n)
+{
+    vp_chksum cs = vp->chksum.initial;
+    maybe(vp_calculate_part_checksum(vp, 0U, n, &cs));
     vp->result.payload = cs;
     return 0;
 }
 
+/**
+ * Update payload checksum result for a replaced part of the payload
+ *
+ * This calculates the payload checksum for the payload after replacing `n`
+ * octets at `offset`, based on the payload checksum in the local meta data
+ * block. The checksum implementation must provide the `zeros` function.
+ *
+ * For data of equal length, the difference of two CRCs is the CRC (with zero
+ * as its initial value) of the difference of the data. Here, that is the CRC
+ * of the previous and new content of the replaced part, which the caller
+ * passes in as `delta`, extended by the number of octets that follow it.
+ *
+ * The updated datum is stored in `vp->result.payload`.
+ *
+ * @param  vp      VersionedPersistence instance to update
+ * @param  delta   Difference of the checksums of previous and new content
+ * @param  offset  Offset of the replaced part in the payload
+ * @param  n       Length of the replaced part
+ *
+ * @sideeffects Modifies vp->result.
+ */
+void
+vp_calculate_payload_delta(VersionedPersistence *vp, const vp_chksum delta,
+                           const size_t offset, const size_t n)
+{
+    const size_t following = get_length(vp) - offset - n;
+    vp->result.payload = get_payload_chksum(vp)
+        ^ vp->chksum.zeros(delta, following);
+}
+
+/**
+ * Write part of the payload, optionally checksumming it on the way
+ *
+ * With a checksum to update, data is written in pieces of VP_STORE_CHUNK
+ * octets, each of which is checksummed right after writing it, while it is
+ * still in the cache. So the data is only fetched from memory once.
+ *
+ * @param  vp      VersionedPersistence instance to write to
+ * @param  src     Pointer to the data to write
+ * @param  offset  Offset of the part in the payload
+ * @param  n       Length of the part
+ * @param  sum     Pointer to the checksum to update; may be NULL
+ *
+ * @return Number of octets written; negative errno otherwise.
+ * @sideeffects Performs IO with the configured data sink; modifies *sum.
+ */
+ssize_t
+vp_store_payload(VersionedPersistence *vp, const void *src,
+                 const size_t offset, const size_t n, vp_chksum *sum)
+{
+    maybe(sink_seek(&vp->data.sink, vp->data.address + VP_SIZE_META + offset));
+    if (sum == NULL) {
+        return sink_put_chunk(&vp->data.sink, src, n);
+    }
+
+    const unsigned char *from = src;
+    size_t rest = n;
+    while (rest > 0U) {
+        const size_t k = rest > VP_STORE_CHUNK ? VP_STORE_CHUNK : rest;
+        const ssize_t rc = sink_put_chunk(&vp->data.sink, from, k);
+        if (rc < 0) {
+            return rc;
+        }
+        *sum = vp->chksum.process(*sum, from, k);
+        from += k;
+        rest -= k;
+    }
+
+    return (ssize_t)n;
+}
+
 /**
  * Load local copy of meta data block from configured memory and check it
  *
@@ -154,6 +250,25 @@ vp_store_header(VersionedPersistence *vp)
     return 0;
 }
 
+/**
+ * Put checksum results into local meta data block
+ *
+ * The payload checksum is taken from `vp->result.payload`; the header checksum
+ * is calculated afterwards, since it covers the payload checksum.
+ *
+ * @param  vp  VersionedPersistence instance to update
+ *
+ * @sideeffects Modifies local meta data header copy and vp->result.
+ */
+static void
+put_checksums(VersionedPersistence *vp)
+{
+    put_payload_chksum(vp, vp->result.payload);
+    vp_calculate_header_checksum(vp);
+    put_header_chksum(vp, vp->result.header);
+    vp_calculate_header_checksum(vp);
+}
+
 /**
  * Correctly update checksum values in local meta data block
  *
@@ -168,10 +283,7 @@ vp_update_checksums(VersionedPersistence *vp)
     const vp_length n = get_length(vp);
     /* Order is important here: First payload checksum, then header. */
     maybe(vp_calculate_payload_checksum(vp, n));
-    put_payload_chksum(vp, vp->result.payload);
-    vp_calculate_header_checksum(vp);
-    put_header_chksum(vp, vp->result.header);
-    vp_calculate_header_checksum(vp);
+    put_checksums(vp);
     return 0;
 }
 
@@ -196,3 +308,23 @@ vp_update_meta(VersionedPersistence *vp)
     maybe(vp_update_checksums(vp));
     return vp_store_header(vp);
 }
+
+/**
+ * Update meta data header in persistent memory with known payload checksum
+ *
+ * This is like vp_update_meta(), but the payload checksum is taken from
+ * `vp->result.payload`, which has to be set up by the caller, usually from
+ * the checksum vp_store_payload() computed, or via
+ * vp_calculate_payload_delta(). Only the header checksum is calculated.
+ *
+ * @param  vp  VersionedPersistence instance to update
+ *
+ * @return Zero if no errors occured; negative errno otherwise.
+ * @sideeffects Performs IO with the configured data sink.
+ */
+int
+vp_update_meta_incremental(VersionedPersistence *vp)
+{
+    put_checksums(vp);
+    return vp_store_header(vp);
+}
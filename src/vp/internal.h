@@ -31,6 +31,9 @@
         }                                       \
     } while (0)
 
+/* Size of the pieces vp_store_payload() writes while checksumming */
+#define VP_STORE_CHUNK 256U
+
 #define vp_ref_chksum bf_ref_u16n
 #define vp_set_chksum bf_set_u16n
 #define vp_ref_length bf_ref_u16n
@@ -232,12 +235,20 @@ payload_intact(const VersionedPersistence *vp)
 /* Prototypes for non-inlined functions */
 
 void vp_calculate_header_checksum(VersionedPersistence *vp);
+int vp_calculate_part_checksum(
+    VersionedPersistence *vp, size_t offset, size_t n, vp_chksum *sum);
 int vp_calculate_payload_checksum(
     VersionedPersistence *vp, size_t n);
+void vp_calculate_payload_delta(
+    VersionedPersistence *vp, vp_chksum delta, size_t offset, size_t n);
+ssize_t vp_store_payload(
+    VersionedPersistence *vp, const void *src, size_t offset, size_t n,
+    vp_chksum *sum);
 int vp_read_meta(VersionedPersistence *vp);
 int vp_verify_payload(VersionedPersistence *vp, size_t n);
 int vp_store_header(VersionedPersistence *vp);
 int vp_update_checksums(VersionedPersistence *vp);
 int vp_update_meta(VersionedPersistence *vp);
+int vp_update_meta_incremental(VersionedPersistence *vp);
 
 #endif /* INC_VERSIONED_PERSISTENCE_PRIVATE_H_545e5959 */
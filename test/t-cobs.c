@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ufw/compat/errno.h>
+
+#include <ufw/cobs.h>
+#include <ufw/compiler.h>
+#include <ufw/endpoints.h>
+
+#include <ufw/test/tap.h>
+
+#define MEMORY_SIZE (2048ul)
+
+static unsigned char source_memory[MEMORY_SIZE];
+static unsigned char sink_memory[MEMORY_SIZE];
+
+#define MIN(a,b) (((a) < (b)) ? (a) : (b))
+
+/*
+ * Test vectors
+ *
+ * These are the usual examples for COBS, which cover empty payload, payload
+ * made of zeros only, and blocks right at and around the maximum block size.
+ * The long vectors are filled in by setup_vectors().
+ */
+
+typedef struct CobsVector {
+    const char *name;
+    unsigned char raw[260];
+    size_t rawlen;
+    unsigned char enc[264];
+    size_t enclen;
+} CobsVector;
+
+static CobsVector vectors[] = {
+    { "empty",         { 0 }, 0u, { 0x01, 0x00 }, 2u },
+    { "one zero",      { 0x00 }, 1u, { 0x01, 0x01, 0x00 }, 3u },
+    { "two zeros",     { 0x00, 0x00 }, 2u, { 0x01, 0x01, 0x01, 0x00 }, 4u },
+    { "inner zero",    { 0x11, 0x22, 0x00, 0x33 }, 4u,
+                       { 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 }, 6u },
+    { "no zero",       { 0x11, 0x22, 0x33, 0x44 }, 4u,
+                       { 0x05, 0x11, 0x22, 0x33, 0x44, 0x00 }, 6u },
+    { "trailing zeros", { 0x11, 0x00, 0x00, 0x00 }, 4u,
+                       { 0x02, 0x11, 0x01, 0x01, 0x01, 0x00 }, 6u },
+    { "full block", { 0 }, 0u, { 0 }, 0u },
+    { "full block plus one", { 0 }, 0u, { 0 }, 0u },
+    { "zero, then full block", { 0 }, 0u, { 0 }, 0u },
+    { "full block, then zero", { 0 }, 0u, { 0 }, 0u },
+    { "block across limit", { 0 }, 0u, { 0 }, 0u }
+};
+
+#define VECTORS (sizeof(vectors) / sizeof(*vectors))
+
+static void
+setup_vectors(void)
+{
+    CobsVector *v;
+
+    /* 01..fe -> ff 01..fe 00 */
+    v = &vectors[6];
+    for (size_t i = 0u; i < 254u; ++i) {
+        v->raw[i] = (unsigned char)(i + 1u);
+        v->enc[i + 1u] = (unsigned char)(i + 1u);
+    }
+    v->rawlen = 254u;
+    v->enc[0] = 0xffu;
+    v->enc[255] = 0x00u;
+    v->enclen = 256u;
+
+    /* 01..ff -> ff 01..fe 02 ff 00 */
+    v = &vectors[7];
+    for (size_t i = 0u; i < 255u; ++i) {
+        v->raw[i] = (unsigned char)(i + 1u);
+    }
+    v->rawlen = 255u;
+    v->enc[0] = 0xffu;
+    memcpy(v->enc + 1u, v->raw, 254u);
+    v->enc[255] = 0x02u;
+    v->enc[256] = 0xffu;
+    v->enc[257] = 0x00u;
+    v->enclen = 258u;
+
+    /* 00 01..fe -> 01 ff 01..fe 00 */
+    v = &vectors[8];
+    v->raw[0] = 0x00u;
+    for (size_t i = 0u; i < 254u; ++i) {
+        v->raw[i + 1u] = (unsigned char)(i + 1u);
+    }
+    v->rawlen = 255u;
+    v->enc[0] = 0x01u;
+    v->enc[1] = 0xffu;
+    memcpy(v->enc + 2u, v->raw + 1u, 254u);
+    v->enc[256] = 0x00u;
+    v->enclen = 257u;
+
+    /* 02..ff 00 -> ff 02..ff 01 01 00 */
+    v = &vectors[9];
+    for (size_t i = 0u; i < 254u; ++i) {
+        v->raw[i] = (unsigned char)(i + 2u);
+    }
+    v->raw[254] = 0x00u;
+    v->rawlen = 255u;
+    v->enc[0] = 0xffu;
+    memcpy(v->enc + 1u, v->raw, 254u);
+    v->enc[255] = 0x01u;
+    v->enc[256] = 0x01u;
+    v->enc[257] = 0x00u;
+    v->enclen = 258u;
+
+    /* 03..ff 00 01 -> fe 03..ff 02 01 00 */
+    v = &vectors[10];
+    for (size_t i = 0u; i < 253u; ++i) {
+        v->raw[i] = (unsigned char)(i + 3u);
+    }
+    v->raw[253] = 0x00u;
+    v->raw[254] = 0x01u;
+    v->rawlen = 255u;
+    v->enc[0] = 0xfeu;
+    memcpy(v->enc + 1u, v->raw, 253u);
+    v->enc[254] = 0x02u;
+    v->enc[255] = 0x01u;
+    v->enc[256] = 0x00u;
+    v->enclen = 257u;
+}
+
+static bool
+buffer_is(const ByteBuffer *b, const unsigned char *data, const size_t n)
+{
+    if (b->used != n) {
+        printf("# size: %zu, expected: %zu\n", b->used, n);
+        return false;
+    }
+    return memcmp(b->data, data, n) == 0;
+}
+
+/*
+ * Frame collector for the resumable decoder
+ */
+
+#define MAX_FRAMES 16u
+#define MAX_FRAME_SIZE 640u
+
+typedef struct FeedResult {
+    size_t frames;
+    int status[MAX_FRAMES];
+    size_t size[MAX_FRAMES];
+    unsigned char data[MAX_FRAMES][MAX_FRAME_SIZE];
+} FeedResult;
+
+static int
+collect_frame(void *arg, ByteBuffer *frame, int status)
+{
+    FeedResult *r = arg;
+    if (r->frames >= MAX_FRAMES) {
+        return -ENOMEM;
+    }
+    const size_t n = MIN(frame->used, sizeof(r->data[0]));
+    r->status[r->frames] = status;
+    r->size[r->frames] = frame->used;
+    memcpy(r->data[r->frames], frame->data, n);
+    r->frames++;
+    return 0;
+}
+
+int
+main(UNUSED int argc, UNUSED char **argv)
+{
+    InstrumentableBuffer source_buffer;
+    InstrumentableBuffer sink_buffer;
+    Source source;
+    Sink sink;
+    int rc;
+
+    plan(4 * VECTORS + 9);
+    setup_vectors();
+
+    byte_buffer_space(&source_buffer.buffer, source_memory, MEMORY_SIZE);
+    byte_buffer_space(&sink_buffer.buffer, sink_memory, MEMORY_SIZE);
+    instrumentable_sink(DATA_KIND_OCTET, &sink, &sink_buffer);
+
+    /*
+     * Encoding tests
+     *
+     * The bulk encoder, and the encoder reading from octet and chunk sources
+     * must all produce the expected encoding.
+     */
+
+    for (size_t i = 0u; i < VECTORS; ++i) {
+        const CobsVector *v = &vectors[i];
+        byte_buffer_clear(&sink_buffer.buffer);
+        rc = cobs_encode_buffer(v->raw, v->rawlen, &sink);
+        ok(rc == 0 && buffer_is(&sink_buffer.buffer, v->enc, v->enclen),
+           "COBS bulk encode works: %s", v->name);
+    }
+
+    for (size_t i = 0u; i < VECTORS; ++i) {
+        const CobsVector *v = &vectors[i];
+        instrumentable_source(DATA_KIND_OCTET, &source, &source_buffer);
+        byte_buffer_add(&source_buffer.buffer, v->raw, v->rawlen);
+        byte_buffer_clear(&sink_buffer.buffer);
+        rc = cobs_encode(&source, &sink);
+        ok(rc == 0 && buffer_is(&sink_buffer.buffer, v->enc, v->enclen),
+           "COBS octet source encode works: %s", v->name);
+    }
+
+    for (size_t i = 0u; i < VECTORS; ++i) {
+        const CobsVector *v = &vectors[i];
+        instrumentable_source(DATA_KIND_CHUNK, &source, &source_buffer);
+        instrumentable_chunksize(&source_buffer, 7u);
+        byte_buffer_add(&source_buffer.buffer, v->raw, v->rawlen);
+        byte_buffer_clear(&sink_buffer.buffer);
+        rc = cobs_encode(&source, &sink);
+        ok(rc == 0 && buffer_is(&sink_buffer.buffer, v->enc, v->enclen),
+           "COBS chunk source encode works: %s", v->name);
+    }
+
+    /* Encoding cannot fail, but errors from the sink must be passed on. */
+    instrumentable_until_error_at(&sink_buffer.write.error, 3, -EIO);
+    byte_buffer_clear(&sink_buffer.buffer);
+    rc = cobs_encode_buffer(vectors[3].raw, vectors[3].rawlen, &sink);
+    ok(rc == -EIO, "COBS encoder passes error code correctly, %d", rc);
+    instrumentable_reset_error(&sink_buffer.write.error);
+
+    /*
+     * Decoding tests
+     */
+
+    COBSContext cobs;
+    cobs_context_init(&cobs);
+    instrumentable_source(DATA_KIND_OCTET, &source, &source_buffer);
+    for (size_t i = 0u; i < VECTORS; ++i) {
+        const CobsVector *v = &vectors[i];
+        byte_buffer_add(&source_buffer.buffer, v->enc, v->enclen);
+    }
+    for (size_t i = 0u; i < VECTORS; ++i) {
+        const CobsVector *v = &vectors[i];
+        byte_buffer_clear(&sink_buffer.buffer);
+        rc = cobs_decode(&cobs, &source, &sink);
+        ok(rc == 1 && buffer_is(&sink_buffer.buffer, v->raw, v->rawlen),
+           "COBS decode works: %s", v->name);
+    }
+
+    /* Leading delimiters are skipped; a delimiter in the middle of a block
+     * breaks the frame it terminates, but not the next one. */
+    static const unsigned char broken[] = {
+        0x00, 0x00, 0x05, 'a', 'b', 0x00, 0x03, 'x', 'y', 0x00 };
+    instrumentable_source(DATA_KIND_OCTET, &source, &source_buffer);
+    byte_buffer_add(&source_buffer.buffer, broken, sizeof(broken));
+    byte_buffer_clear(&sink_buffer.buffer);
+    cobs_context_init(&cobs);
+    rc = cobs_decode(&cobs, &source, &sink);
+    ok(rc == -EILSEQ && source_buffer.buffer.offset == 6u,
+       "COBS decode signals ILSEQ at early delimiter (%d)", rc);
+    byte_buffer_clear(&sink_buffer.buffer);
+    rc = cobs_decode(&cobs, &source, &sink);
+    ok(rc == 1 && buffer_is(&sink_buffer.buffer, (const unsigned char*)"xy", 2u),
+       "COBS frame after error decodes correctly");
+
+    /*
+     * Resumable decoder tests
+     */
+
+    {
+        static unsigned char fbuf[260];
+        static unsigned char wire[MEMORY_SIZE * 2u];
+        ByteBuffer frame = BYTE_BUFFER_EMPTY(fbuf, sizeof(fbuf));
+        static FeedResult r;
+        size_t n = 0u;
+        for (size_t i = 0u; i < VECTORS; ++i) {
+            memcpy(wire + n, vectors[i].enc, vectors[i].enclen);
+            n += vectors[i].enclen;
+        }
+
+        /* Feeding one octet at a time splits every block. */
+        memset(&r, 0, sizeof(r));
+        cobs_context_init(&cobs);
+        ssize_t frc = 0;
+        for (size_t i = 0u; i < n && frc >= 0; ++i) {
+            frc = cobs_decode_feed(&cobs, wire + i, 1u, &frame,
+                                   collect_frame, &r);
+        }
+        bool good = (r.frames == VECTORS);
+        for (size_t i = 0u; good && i < VECTORS; ++i) {
+            good = (r.status[i] == 0 && r.size[i] == vectors[i].rawlen
+                    && memcmp(r.data[i], vectors[i].raw, r.size[i]) == 0);
+        }
+        ok(good, "COBS feed, octet by octet, decodes all vectors (%zu)",
+           r.frames);
+
+        /* Decode in place, all frames in one go. */
+        memset(&r, 0, sizeof(r));
+        cobs_context_init(&cobs);
+        ByteBuffer ipframe = BYTE_BUFFER_EMPTY(wire, n);
+        frc = cobs_decode_feed(&cobs, wire, n, &ipframe, collect_frame, &r);
+        good = (frc == (ssize_t)n && r.frames == VECTORS);
+        for (size_t i = 0u; good && i < VECTORS; ++i) {
+            good = (r.status[i] == 0 && r.size[i] == vectors[i].rawlen
+                    && memcmp(r.data[i], vectors[i].raw, r.size[i]) == 0);
+        }
+        ok(good, "COBS feed, in place, decodes all vectors (%zu)", r.frames);
+
+        memset(&r, 0, sizeof(r));
+        cobs_context_init(&cobs);
+        (void)cobs_decode_feed(&cobs, broken, sizeof(broken), &frame,
+                               collect_frame, &r);
+        ok(r.frames == 2u && r.status[0] == -EILSEQ && r.status[1] == 0
+           && r.size[1] == 2u && memcmp(r.data[1], "xy", 2u) == 0,
+           "COBS feed recovers from early delimiter");
+
+        /* Frame too large for the frame buffer, then a valid frame */
+        static const unsigned char large[] = {
+            0x03, 'a', 'b', 0x04, 'c', 'd', 'e', 0x00, 0x03, 'x', 'y', 0x00 };
+        ByteBuffer small = BYTE_BUFFER_EMPTY(fbuf, 4u);
+        memset(&r, 0, sizeof(r));
+        cobs_context_init(&cobs);
+        (void)cobs_decode_feed(&cobs, large, sizeof(large), &small,
+                               collect_frame, &r);
+        ok(r.frames == 2u && r.status[0] == -ENOBUFS && r.status[1] == 0
+           && r.size[1] == 2u && memcmp(r.data[1], "xy", 2u) == 0,
+           "COBS feed recovers from frame buffer overflow");
+
+        /* Round trip payloads of all sizes up to two and a half blocks,
+         * with zeros at varying distances. Buffer sinks implement the
+         * reserve extension, which the bulk encoder uses if available. */
+        size_t failures = 0u;
+        uint32_t state = 0x12345678UL;
+        ByteBuffer wirebuf;
+        Sink bsink;
+        byte_buffer_space(&wirebuf, wire, sizeof(wire));
+        sink_to_buffer(&bsink, &wirebuf);
+        for (size_t size = 0u; size < MAX_FRAME_SIZE; ++size) {
+            static unsigned char raw[MAX_FRAME_SIZE];
+            for (size_t i = 0u; i < size; ++i) {
+                state = (state * 1103515245UL) + 12345UL;
+                const unsigned char octet = (unsigned char)(state >> 16);
+                raw[i] = (octet < 4u) ? 0x00u : octet;
+            }
+            byte_buffer_clear(&wirebuf);
+            rc = cobs_encode_buffer(raw, size, &bsink);
+            const size_t enclen = wirebuf.used;
+            const unsigned char *zero = memchr(wire, 0x00, enclen);
+            static unsigned char dbuf[MAX_FRAME_SIZE];
+            ByteBuffer dframe = BYTE_BUFFER_EMPTY(dbuf, sizeof(dbuf));
+            memset(&r, 0, sizeof(r));
+            cobs_context_init(&cobs);
+            (void)cobs_decode_feed(&cobs, wire, enclen, &dframe,
+                                   collect_frame, &r);
+            if (rc < 0 || enclen > COBS_WORST_CASE(size)
+                || zero != wire + enclen - 1u
+                || r.frames != 1u || r.status[0] != 0 || r.size[0] != size
+                || memcmp(r.data[0], raw, size) != 0)
+            {
+                printf("# round trip failed with size %zu\n", size);
+                failures++;
+            }
+        }
+        ok(failures == 0u, "COBS round trip works for all sizes");
+    }
+
+    /* Finally check that errors are passed properly */
+    instrumentable_until_error_at(&sink_buffer.write.error, 2, -EIO);
+    byte_buffer_space(&sink_buffer.buffer, sink_memory, MEMORY_SIZE);
+    instrumentable_source(DATA_KIND_OCTET, &source, &source_buffer);
+    byte_buffer_add(&source_buffer.buffer, vectors[4].enc, vectors[4].enclen);
+    cobs_context_init(&cobs);
+    rc = cobs_decode(&cobs, &source, &sink);
+    ok(rc == -EIO, "COBS decoder passes error code correctly, %d", rc);
+    instrumentable_reset_error(&sink_buffer.write.error);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ufw/compat/errno.h>
+
+#include <ufw/compiler.h>
+#include <ufw/crc/crc.h>
+#include <ufw/crc/crc16-ccitt.h>
+#include <ufw/crc/crc32.h>
+#include <ufw/crc/crc32c.h>
+#include <ufw/persistent-storage.h>
+#include <ufw/versioned-persistence.h>
+
+#include <ufw/test/tap.h>
+
+#define DATA_SIZE 1024U
+#define LARGE_SIZE 8192U
+
+static uint8_t data[DATA_SIZE + 16U];
+static uint8_t zeros[DATA_SIZE];
+static uint8_t large[LARGE_SIZE];
+
+/* The generated API of all CRCs, widened to 32 bits for testing. */
+typedef struct CrcModel {
+    const char *name;
+    unsigned int width;
+    uint32_t poly;
+    uint32_t init;
+    bool refin;
+    bool refout;
+    uint32_t xorout;
+    uint32_t check;
+    uint32_t initial;
+    uint32_t (*update)(uint32_t, const void*, size_t);
+    uint32_t (*buffer)(const void*, size_t);
+    uint32_t (*zeros)(uint32_t, size_t);
+    uint32_t (*combine)(uint32_t, uint32_t, size_t);
+    uint32_t (*replace)(uint32_t, size_t, size_t,
+                        const void*, const void*, size_t);
+    uint32_t (*copy)(uint32_t, void*, const void*, size_t);
+} CrcModel;
+
+#define WRAP(NAME,TYPE)                                                 \
+    static uint32_t                                                     \
+    NAME##_u(uint32_t crc, const void *buf, size_t n)                   \
+    {                                                                   \
+        return NAME((TYPE)crc, buf, n);                                 \
+    }                                                                   \
+    static uint32_t                                                     \
+    NAME##_b(const void *buf, size_t n)                                 \
+    {                                                                   \
+        return NAME##_buffer(buf, n);                                   \
+    }                                                                   \
+    static uint32_t                                                     \
+    NAME##_z(uint32_t crc, size_t n)                                    \
+    {                                                                   \
+        return NAME##_zeros((TYPE)crc, n);                              \
+    }                                                                   \
+    static uint32_t                                                     \
+    NAME##_c(uint32_t a, uint32_t b, size_t n)                          \
+    {                                                                   \
+        return NAME##_combine((TYPE)a, (TYPE)b, n);                     \
+    }                                                                   \
+    static uint32_t                                                     \
+    NAME##_r(uint32_t crc, size_t len, size_t offset,                   \
+             const void *prev, const void *next, size_t n)              \
+    {                                                                   \
+        return NAME##_replace((TYPE)crc, len, offset, prev, next, n);   \
+    }                                                                   \
+    static uint32_t                                                     \
+    NAME##_m(uint32_t crc, void *dst, const void *src, size_t n)        \
+    {                                                                   \
+        return NAME##_memcpy((TYPE)crc, dst, src, n);                   \
+    }
+
+WRAP(ufw_crc32, uint32_t)
+WRAP(ufw_crc32c, uint32_t)
+WRAP(ufw_crc16_ccitt, uint16_t)
+
+#define MODEL(NAME) NAME##_u, NAME##_b, NAME##_z, NAME##_c, NAME##_r, NAME##_m
+
+static const CrcModel models[] = {
+    { "crc-32", 32U, 0x04c11db7UL, 0xffffffffUL, true, true, 0xffffffffUL,
+      0xcbf43926UL, CRC32_INITIAL, MODEL(ufw_crc32) },
+    { "crc-32c", 32U, 0x1edc6f41UL, 0xffffffffUL, true, true, 0xffffffffUL,
+      0xe3069283UL, CRC32C_INITIAL, MODEL(ufw_crc32c) },
+    { "crc-16/ccitt-false", 16U, 0x1021U, 0xffffU, false, false, 0x0000U,
+      0x29b1U, CRC16_CCITT_INITIAL, MODEL(ufw_crc16_ccitt) }
+};
+
+#define MODELS (sizeof(models) / sizeof(*models))
+
+static uint32_t
+reflect(uint32_t value, const unsigned int width)
+{
+    uint32_t rv = 0U;
+    for (unsigned int i = 0U; i < width; ++i) {
+        rv = (rv << 1U) | (value & 1U);
+        value >>= 1U;
+    }
+    return rv;
+}
+
+/* Bit-wise reference implementation of the Rocksoft model */
+static uint32_t
+reference(const CrcModel *m, const uint8_t *src, const size_t n)
+{
+    const uint32_t top = 1UL << (m->width - 1U);
+    const uint32_t mask = (top - 1U) | top;
+    uint32_t reg = m->init;
+    for (size_t i = 0U; i < n; ++i) {
+        const uint32_t octet = m->refin ? reflect(src[i], 8U) : src[i];
+        reg ^= octet << (m->width - 8U);
+        for (unsigned int b = 0U; b < 8U; ++b) {
+            reg = (reg & top) ? ((reg << 1U) ^ m->poly) : (reg << 1U);
+        }
+        reg &= mask;
+    }
+    if (m->refout) {
+        reg = reflect(reg, m->width);
+    }
+    return (reg ^ m->xorout) & mask;
+}
+
+static bool
+matches_reference(const CrcModel *m)
+{
+    for (size_t off = 0U; off < 16U; ++off) {
+        for (size_t n = 0U; n <= 300U; ++n) {
+            const uint8_t *p = data + off;
+            if (m->buffer(p, n) != reference(m, p, n))
+                return false;
+        }
+    }
+    for (size_t n = 512U; n <= DATA_SIZE; n += 37U) {
+        if (m->buffer(data, n) != reference(m, data, n))
+            return false;
+    }
+    return true;
+}
+
+static bool
+chains(const CrcModel *m)
+{
+    uint32_t crc = m->initial;
+    size_t done = 0U;
+    for (size_t step = 1U; done < DATA_SIZE; step = step * 3U + 1U) {
+        const size_t n = (DATA_SIZE - done) < step ? DATA_SIZE - done : step;
+        crc = m->update(crc, data + done, n);
+        done += n;
+    }
+    return crc == m->buffer(data, DATA_SIZE);
+}
+
+/* The difference of the CRCs of two blocks of equal length, extended by n
+ * zero octets, is the difference after appending n zero octets to both. */
+static bool
+extends_difference(const CrcModel *m)
+{
+    const uint32_t a = m->buffer(data, 100U);
+    const uint32_t b = m->buffer(data + 100U, 100U);
+    for (size_t n = 0U; n <= DATA_SIZE; n += 31U) {
+        const uint32_t az = m->update(a, zeros, n);
+        const uint32_t bz = m->update(b, zeros, n);
+        if (m->zeros(a ^ b, n) != (az ^ bz))
+            return false;
+    }
+    return true;
+}
+
+static bool
+combines(const CrcModel *m)
+{
+    for (size_t k = 0U; k <= DATA_SIZE; k += 97U) {
+        const uint32_t a = m->buffer(data, k);
+        const uint32_t b = m->buffer(data + k, DATA_SIZE - k);
+        if (m->combine(a, b, DATA_SIZE - k) != m->buffer(data, DATA_SIZE))
+            return false;
+    }
+    return true;
+}
+
+static bool
+replaces(const CrcModel *m)
+{
+    static uint8_t changed[DATA_SIZE];
+    const size_t offset = 333U;
+    const size_t n = 17U;
+    memcpy(changed, data, DATA_SIZE);
+    const uint32_t before = m->buffer(changed, DATA_SIZE);
+    for (size_t i = 0U; i < n; ++i) {
+        changed[offset + i] ^= (uint8_t)(i * 7U + 1U);
+    }
+    return m->replace(before, DATA_SIZE, offset, data + offset,
+                      changed + offset, n)
+        == m->buffer(changed, DATA_SIZE);
+}
+
+/* Copying yields the same CRC as computing it, and copies the data. Use
+ * sizes beyond UFW_CRC_COPY_CHUNK to cover copying in blocks. */
+static bool
+copies(const CrcModel *m)
+{
+    static uint8_t copy[LARGE_SIZE];
+    for (size_t n = 0U; n < LARGE_SIZE; n += 1237U) {
+        memset(copy, 0, sizeof(copy));
+        if (m->copy(m->initial, copy, large + 1U, n)
+            != m->buffer(large + 1U, n)
+            || memcmp(copy, large + 1U, n) != 0)
+            return false;
+        if (m->copy(m->initial, copy, copy, n) != m->buffer(large + 1U, n))
+            return false;
+    }
+    return true;
+}
+
+static const struct {
+    CRC32CImpl impl;
+    const char *name;
+} crc32c_impls[] = {
+    { CRC32C_TABLE,    "table" },
+    { CRC32C_FOLD,     "fold" },
+    { CRC32C_HARDWARE, "hardware" }
+};
+
+#define CRC32C_IMPLS (sizeof(crc32c_impls) / sizeof(*crc32c_impls))
+
+/* Large inputs take different paths through some implementations. */
+static bool
+crc32c_matches_reference(void)
+{
+    const CrcModel *m = models + 1;
+    if (matches_reference(m) == false || chains(m) == false)
+        return false;
+    for (size_t n = 1500U; n <= LARGE_SIZE; n += 509U) {
+        if (m->buffer(large, n) != reference(m, large, n))
+            return false;
+    }
+    return m->buffer(large, LARGE_SIZE) == reference(m, large, LARGE_SIZE);
+}
+
+int
+main(UNUSED int argc, UNUSED char **argv)
+{
+    plan(7 * MODELS + 2 * CRC32C_IMPLS + 2);
+
+    srand(0xc4c);
+    for (size_t i = 0U; i < sizeof(data); ++i) {
+        data[i] = (uint8_t)rand();
+    }
+    for (size_t i = 0U; i < sizeof(large); ++i) {
+        large[i] = (uint8_t)rand();
+    }
+
+    for (size_t i = 0U; i < MODELS; ++i) {
+        const CrcModel *m = models + i;
+        ok(m->buffer("123456789", 9U) == m->check
+           && m->buffer(NULL, 0U) == m->initial,
+           "%s: check value is correct", m->name);
+        ok(matches_reference(m), "%s: matches reference", m->name);
+        ok(chains(m), "%s: works in pieces", m->name);
+        ok(extends_difference(m), "%s: zeros() extends differences",
+           m->name);
+        ok(combines(m), "%s: combine() matches processing both blocks",
+           m->name);
+        ok(replaces(m), "%s: replace() matches recalculation", m->name);
+        ok(copies(m), "%s: memcpy() copies and computes CRC", m->name);
+    }
+
+    for (size_t i = 0U; i < CRC32C_IMPLS; ++i) {
+        if (ufw_crc32c_available(crc32c_impls[i].impl) == false) {
+            ok(ufw_crc32c_select(crc32c_impls[i].impl) == -ENOTSUP,
+               "crc-32c/%s: not available, selection fails",
+               crc32c_impls[i].name);
+            ok(true, "crc-32c/%s: not available, skipping reference test",
+               crc32c_impls[i].name);
+            continue;
+        }
+        const int rc = ufw_crc32c_select(crc32c_impls[i].impl);
+        ok(rc == 0 && ufw_crc32c_active() == crc32c_impls[i].impl
+           && ufw_crc32c_buffer("123456789", 9U) == 0xe3069283UL,
+           "crc-32c/%s: check value is correct", crc32c_impls[i].name);
+        ok(crc32c_matches_reference(), "crc-32c/%s: matches reference",
+           crc32c_impls[i].name);
+    }
+
+    ufw_crc32c_init();
+    const CRC32CImpl active = ufw_crc32c_active();
+    ok(active != CRC32C_AUTO && ufw_crc32c_available(active)
+       && (active == CRC32C_HARDWARE
+           || ufw_crc32c_available(CRC32C_HARDWARE) == false),
+       "crc-32c: init selects an available implementation (%d)",
+       (int)active);
+
+    {
+        /* The generated functions fit the checksum callbacks. */
+        const PersistentChksum32 p32 = ufw_crc32_persistent;
+        const PersistentChksum16 p16 = ufw_crc16_ccitt_persistent;
+        const PersistentChksumZeros32 z32 = ufw_crc32_zeros;
+        const vp_chksum_fnc vp = ufw_crc16_ccitt;
+        const vp_chksum_zeros_fnc vpz = ufw_crc16_ccitt_zeros;
+        ok(p32(data, 100U, CRC32_INITIAL) == ufw_crc32_buffer(data, 100U)
+           && p16(data, 100U, CRC16_CCITT_INITIAL)
+              == ufw_crc16_ccitt_buffer(data, 100U)
+           && vp(CRC16_CCITT_INITIAL, data, 100U)
+              == ufw_crc16_ccitt_buffer(data, 100U)
+           && z32(0U, 10U) == 0U && vpz(0U, 10U) == 0U,
+           "generated functions work as checksum callbacks");
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ufw/compat/errno.h>
+
+#include <ufw/compiler.h>
+#include <ufw/crc/crc16-arc.h>
+
+#include <ufw/test/tap.h>
+
+#define DATA_SIZE 1024U
+
+static uint8_t data[DATA_SIZE + 16U];
+
+static const struct {
+    CRC16ArcImpl impl;
+    const char *name;
+} impls[] = {
+    { CRC16_ARC_BYTEWISE,    "bytewise" },
+    { CRC16_ARC_SLICE_BY_8,  "slice-by-8" },
+    { CRC16_ARC_SLICE_BY_16, "slice-by-16" },
+    { CRC16_ARC_CLMUL,       "clmul" }
+};
+
+#define IMPLS (sizeof(impls) / sizeof(*impls))
+
+/* Bit-wise reference implementation */
+static uint16_t
+crc16_reference(uint16_t crc, const uint8_t *src, size_t n)
+{
+    for (size_t i = 0U; i < n; ++i) {
+        crc ^= src[i];
+        for (unsigned int b = 0U; b < 8U; ++b) {
+            crc = (crc & 1U) ? (uint16_t)((crc >> 1U) ^ 0xa001U)
+                             : (uint16_t)(crc >> 1U);
+        }
+    }
+    return crc;
+}
+
+/* Compare all lengths up to 300 at all alignments modulo 16, and a couple of
+ * larger blocks, with a non-zero initial value. */
+static bool
+matches_reference(void)
+{
+    for (size_t off = 0U; off < 16U; ++off) {
+        for (size_t n = 0U; n <= 300U; ++n) {
+            const uint8_t *p = data + off;
+            if (ufw_crc16_arc(0x1234U, p, n) != crc16_reference(0x1234U, p, n))
+                return false;
+        }
+    }
+    for (size_t n = 512U; n <= DATA_SIZE; n += 37U) {
+        if (ufw_crc16_arc(0U, data, n) != crc16_reference(0U, data, n))
+            return false;
+    }
+    return true;
+}
+
+/* Computing the CRC in pieces yields the same result as in one go. */
+static bool
+chains(void)
+{
+    const uint16_t full = ufw_buffer_crc16_arc(data, DATA_SIZE);
+    uint16_t crc = CRC16_ARC_INITIAL;
+    size_t done = 0U;
+    for (size_t step = 1U; done < DATA_SIZE; step = step * 3U + 1U) {
+        const size_t n = (DATA_SIZE - done) < step ? DATA_SIZE - done : step;
+        crc = ufw_crc16_arc(crc, data + done, n);
+        done += n;
+    }
+    return crc == full;
+}
+
+/* Copying yields the same CRC as computing it, and copies the data. */
+static bool
+copies(void)
+{
+    static uint8_t copy[DATA_SIZE];
+    for (size_t n = 0U; n <= DATA_SIZE; n += 61U) {
+        memset(copy, 0, sizeof(copy));
+        if (ufw_crc16_arc_memcpy(0x1234U, copy, data + 3U, n)
+            != ufw_crc16_arc(0x1234U, data + 3U, n)
+            || memcmp(copy, data + 3U, n) != 0)
+            return false;
+        if (ufw_crc16_arc_memcpy(0x1234U, copy, copy, n)
+            != ufw_crc16_arc(0x1234U, data + 3U, n))
+            return false;
+    }
+    return true;
+}
+
+int
+main(UNUSED int argc, UNUSED char **argv)
+{
+    plan(4 * IMPLS + 5);
+
+    srand(0x16a1c);
+    for (size_t i = 0U; i < sizeof(data); ++i) {
+        data[i] = (uint8_t)rand();
+    }
+
+    for (size_t i = 0U; i < IMPLS; ++i) {
+        if (ufw_crc16_arc_available(impls[i].impl) == false) {
+            const int rc = ufw_crc16_arc_select(impls[i].impl);
+            ok(rc == -ENOTSUP, "%s: not available, selection fails",
+               impls[i].name);
+            ok(true, "%s: not available, skipping reference test",
+               impls[i].name);
+            ok(true, "%s: not available, skipping chaining test",
+               impls[i].name);
+            ok(true, "%s: not available, skipping copying test",
+               impls[i].name);
+            continue;
+        }
+        const int rc = ufw_crc16_arc_select(impls[i].impl);
+        ok(rc == 0 && ufw_crc16_arc_active() == impls[i].impl
+           && ufw_buffer_crc16_arc("123456789", 9U) == 0xbb3dU,
+           "%s: check value is correct", impls[i].name);
+        ok(matches_reference(), "%s: matches reference", impls[i].name);
+        ok(chains(), "%s: works in pieces", impls[i].name);
+        ok(copies(), "%s: memcpy() copies and computes CRC", impls[i].name);
+    }
+
+    ufw_crc16_arc_init();
+    const CRC16ArcImpl active = ufw_crc16_arc_active();
+    ok(active != CRC16_ARC_AUTO && ufw_crc16_arc_available(active)
+       && (active == CRC16_ARC_CLMUL
+           || ufw_crc16_arc_available(CRC16_ARC_CLMUL) == false),
+       "init selects an available implementation (%d)", (int)active);
+
+    {
+        /* Zero extension, combination and replacement */
+        static uint8_t zeros[DATA_SIZE];
+        bool good = true;
+        for (size_t n = 0U; n <= DATA_SIZE; n += 31U) {
+            const uint16_t crc = ufw_buffer_crc16_arc(data, 100U);
+            good = good && (ufw_crc16_arc_zeros(crc, n)
+                            == ufw_crc16_arc(crc, zeros, n));
+        }
+        ok(good, "zeros() matches processing zero octets");
+
+        good = true;
+        for (size_t k = 0U; k <= DATA_SIZE; k += 97U) {
+            const uint16_t a = ufw_buffer_crc16_arc(data, k);
+            const uint16_t b = ufw_buffer_crc16_arc(data + k, DATA_SIZE - k);
+            good = good && (ufw_crc16_arc_combine(a, b, DATA_SIZE - k)
+                            == ufw_buffer_crc16_arc(data, DATA_SIZE));
+        }
+        ok(good, "combine() matches processing both blocks");
+
+        static uint8_t changed[DATA_SIZE];
+        memcpy(changed, data, DATA_SIZE);
+        const uint16_t before = ufw_crc16_arc(0x5555U, changed, DATA_SIZE);
+        const size_t offset = 333U;
+        const size_t n = 17U;
+        for (size_t i = 0U; i < n; ++i) {
+            changed[offset + i] ^= (uint8_t)(i * 7U + 1U);
+        }
+        ok(ufw_crc16_arc_replace(before, DATA_SIZE, offset, data + offset,
+                                 changed + offset, n)
+           == ufw_crc16_arc(0x5555U, changed, DATA_SIZE),
+           "replace() matches recalculation");
+    }
+
+    uint16_t words[DATA_SIZE / 2U];
+    memcpy(words, data, sizeof(words));
+    ok(ufw_buffer_crc16_arc_u16(words, DATA_SIZE / 2U)
+       == crc16_reference(0U, data, DATA_SIZE),
+       "u16 API processes words in memory order");
+
+    return EXIT_SUCCESS;
+}
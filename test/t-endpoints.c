@@ -7,9 +7,16 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <ufw/toolchain.h>
+
+#ifdef WITH_UNISTD_H
+#include <unistd.h>
+#endif /* WITH_UNISTD_H */
+
 #include <ufw/compat/errno.h>
 #include <ufw/compiler.h>
 #include <ufw/endpoints.h>
+#include <ufw/endpoints/buffered.h>
 
 #include <ufw/test/tap.h>
 
@@ -23,6 +30,16 @@ static unsigned char snk_bc[SNK_SIZE];
 #define AUX_SIZE (128u)
 static unsigned char auxb[AUX_SIZE];
 
+#define RA_SIZE (64u)
+static unsigned char rab[RA_SIZE];
+#define WC_SIZE (64u)
+static unsigned char wcb[WC_SIZE];
+
+static unsigned char src_bv[SRC_SIZE];
+static unsigned char snk_bv[SNK_SIZE];
+static InstrumentableBuffer isrc_bv = INSTRUMENTABLE_BUFFER(src_bv, SRC_SIZE);
+static InstrumentableBuffer isnk_bv = INSTRUMENTABLE_BUFFER(snk_bv, SNK_SIZE);
+
 static InstrumentableBuffer isrc_bo = INSTRUMENTABLE_BUFFER(src_bo, SRC_SIZE);
 static InstrumentableBuffer isnk_bo = INSTRUMENTABLE_BUFFER(snk_bo, SNK_SIZE);
 static InstrumentableBuffer isrc_bc = INSTRUMENTABLE_BUFFER(src_bc, SRC_SIZE);
@@ -48,10 +65,13 @@ test_reset(void)
     test_reset_meta(&isrc_bc);
     test_reset_meta(&isnk_bo);
     test_reset_meta(&isnk_bc);
+    test_reset_meta(&isrc_bv);
+    test_reset_meta(&isnk_bv);
 
     /* Clear out buffers that are used by sinks */
     byte_buffer_clear(&isnk_bo.buffer);
     byte_buffer_clear(&isnk_bc.buffer);
+    byte_buffer_clear(&isnk_bv.buffer);
 
     /* Fill buffers associated with sources to a well know and simple pattern.
      * The octet source counts up, the chunk source counts down. This is to be
@@ -61,18 +81,23 @@ test_reset(void)
 
     byte_buffer_fillx(&isrc_bc.buffer, 0, -1);
     byte_buffer_repeat(&isrc_bc.buffer);
+
+    byte_buffer_fillx(&isrc_bv.buffer, 0x80, 1);
+    byte_buffer_repeat(&isrc_bv.buffer);
 }
 
 int
 main(UNUSED int argc, UNUSED char **argv)
 {
     ssize_t rc;
-    Source src_o, src_c;
-    Sink snk_o, snk_c;
+    Source src_o, src_c, src_v;
+    Sink snk_o, snk_c, snk_v;
     instrumentable_source(DATA_KIND_OCTET, &src_o, &isrc_bo);
     instrumentable_sink(DATA_KIND_OCTET,   &snk_o, &isnk_bo);
     instrumentable_source(DATA_KIND_CHUNK, &src_c, &isrc_bc);
     instrumentable_sink(DATA_KIND_CHUNK,   &snk_c, &isnk_bc);
+    instrumentable_source(DATA_KIND_VECTOR, &src_v, &isrc_bv);
+    instrumentable_sink(DATA_KIND_VECTOR,   &snk_v, &isnk_bv);
     ByteBuffer aux = BYTE_BUFFER_EMPTY(auxb, AUX_SIZE);
 
     tap_init();
@@ -126,6 +151,329 @@ main(UNUSED int argc, UNUSED char **argv)
     cmp_mem(isrc_bc.buffer.data, isnk_bc.buffer.data,
             isrc_bc.buffer.size, "drain: Source(c) and sink(c) memory match");
 
+    /*
+     * Buffered sources read ahead in large chunks and serve everything else
+     * from memory. Make the wrapped source hand out as much as it is asked
+     * for, so access counts are predictable.
+     */
+
+    test_reset();
+    instrumentable_chunksize(&isrc_bc, SRC_SIZE);
+    {
+        static unsigned char buf[SRC_SIZE];
+        ByteBuffer ra = BYTE_BUFFER_EMPTY(rab, RA_SIZE);
+        BufferedSource bsd = BUFFERED_SOURCE(&src_c, &ra);
+        Source bsrc;
+        buffered_source_init(&bsrc, &bsd);
+        bool allok = true;
+        for (size_t i = 0u; i < SRC_SIZE; ++i) {
+            if (source_get_octet(&bsrc, buf + i) != 1) {
+                allok = false;
+                break;
+            }
+        }
+        ok(allok, "buffered: octet reads all succeed");
+        cmp_mem(isrc_bc.buffer.data, buf, SRC_SIZE,
+                "buffered: octet reads produce source data");
+        ok(isrc_bc.read.stat.accesses == SRC_SIZE / RA_SIZE,
+           "buffered: octet reads cause %zu source accesses (%zu)",
+           SRC_SIZE / RA_SIZE, isrc_bc.read.stat.accesses);
+        rc = source_get_octet(&bsrc, buf);
+        ok(rc == -ENODATA, "buffered: exhausted source signals -ENODATA");
+    }
+
+    test_reset();
+    instrumentable_chunksize(&isrc_bc, SRC_SIZE);
+    {
+        static unsigned char buf[SRC_SIZE];
+        ByteBuffer ra = BYTE_BUFFER_EMPTY(rab, RA_SIZE);
+        BufferedSource bsd = BUFFERED_SOURCE(&src_c, &ra);
+        Source bsrc;
+        buffered_source_init(&bsrc, &bsd);
+        rc = source_get_octet(&bsrc, buf);
+        ok(rc == 1, "buffered: mixed, octet read works (%zd)", rc);
+        ok(buffered_source_pending(&bsd) == RA_SIZE - 1u,
+           "buffered: mixed, read-ahead is pending (%zu)",
+           buffered_source_pending(&bsd));
+        rc = source_get_chunk(&bsrc, buf + 1u, 100u);
+        ok(rc == 100, "buffered: mixed, chunk across refill works (%zd)", rc);
+        rc = source_get_chunk(&bsrc, buf + 101u, SRC_SIZE - 101u);
+        ok(rc == (ssize_t)(SRC_SIZE - 101u),
+           "buffered: mixed, large chunk works (%zd)", rc);
+        cmp_mem(isrc_bc.buffer.data, buf, SRC_SIZE,
+                "buffered: mixed reads produce source data");
+    }
+
+    test_reset();
+    instrumentable_chunksize(&isrc_bc, SRC_SIZE);
+    instrumentable_chunksize(&isnk_bc, SNK_SIZE);
+    {
+        ByteBuffer ra = BYTE_BUFFER_EMPTY(rab, RA_SIZE);
+        BufferedSource bsd = BUFFERED_SOURCE(&src_c, &ra);
+        Source bsrc;
+        buffered_source_init(&bsrc, &bsd);
+        rc = sts_n(&bsrc, &snk_c, SRC_SIZE);
+        ok(rc == SRC_SIZE, "buffered: c->c via getbuffer works (%zd)", rc);
+        cmp_mem(isrc_bc.buffer.data, isnk_bc.buffer.data, SRC_SIZE,
+                "buffered: Source(c) and sink(c) memory match");
+        ok(isrc_bc.read.stat.accesses == SRC_SIZE / RA_SIZE,
+           "buffered: sts_n causes %zu source accesses (%zu)",
+           SRC_SIZE / RA_SIZE, isrc_bc.read.stat.accesses);
+    }
+
+    /*
+     * Buffered sinks combine small writes into large ones, and pass them on
+     * when full, or when flushed.
+     */
+
+    test_reset();
+    instrumentable_chunksize(&isnk_bc, SNK_SIZE);
+    {
+        ByteBuffer wc = BYTE_BUFFER_EMPTY(wcb, WC_SIZE);
+        BufferedSink bsd = BUFFERED_SINK(&snk_c, &wc, 0u);
+        Sink bsnk;
+        buffered_sink_init(&bsnk, &bsd);
+        bool allok = true;
+        for (size_t i = 0u; i < SRC_SIZE; ++i) {
+            if (sink_put_octet(&bsnk, isrc_bo.buffer.data[i]) != 1) {
+                allok = false;
+                break;
+            }
+        }
+        ok(allok, "buffered: octet writes all succeed");
+        ok(buffered_sink_pending(&bsd) == WC_SIZE,
+           "buffered: last block is held back (%zu)",
+           buffered_sink_pending(&bsd));
+        rc = sink_flush(&bsnk);
+        ok(rc == 0, "buffered: flush works (%zd)", rc);
+        ok(buffered_sink_pending(&bsd) == 0u,
+           "buffered: nothing is pending after flush");
+        cmp_mem(isrc_bo.buffer.data, isnk_bc.buffer.data, SRC_SIZE,
+                "buffered: octet writes produce source data");
+        ok(isnk_bc.write.stat.accesses == SRC_SIZE / WC_SIZE,
+           "buffered: octet writes cause %zu sink accesses (%zu)",
+           SRC_SIZE / WC_SIZE, isnk_bc.write.stat.accesses);
+    }
+
+    test_reset();
+    instrumentable_chunksize(&isrc_bc, SRC_SIZE);
+    instrumentable_chunksize(&isnk_bc, SNK_SIZE);
+    {
+        ByteBuffer wc = BYTE_BUFFER_EMPTY(wcb, WC_SIZE);
+        BufferedSink bsd = BUFFERED_SINK(&snk_c, &wc, 0u);
+        Sink bsnk;
+        buffered_sink_init(&bsnk, &bsd);
+        rc = sts_n(&src_c, &bsnk, SRC_SIZE);
+        ok(rc == SRC_SIZE, "buffered: c->buffered via getbuffer works (%zd)",
+           rc);
+        rc = sink_flush(&bsnk);
+        ok(rc == 0, "buffered: flush works (%zd)", rc);
+        cmp_mem(isrc_bc.buffer.data, isnk_bc.buffer.data, SRC_SIZE,
+                "buffered: Source(c) and buffered sink memory match");
+        ok(isnk_bc.write.stat.accesses == SRC_SIZE / WC_SIZE,
+           "buffered: sts_n causes %zu sink accesses (%zu)",
+           SRC_SIZE / WC_SIZE, isnk_bc.write.stat.accesses);
+    }
+
+    test_reset();
+    instrumentable_chunksize(&isnk_bc, SNK_SIZE);
+    {
+        ByteBuffer wc = BYTE_BUFFER_EMPTY(wcb, WC_SIZE);
+        BufferedSink bsd = BUFFERED_SINK(&snk_c, &wc, 0u);
+        Sink bsnk;
+        buffered_sink_init(&bsnk, &bsd);
+        rc = sink_put_chunk(&bsnk, isrc_bo.buffer.data, 10u);
+        ok(rc == 10, "buffered: small chunk is accepted (%zd)", rc);
+        rc = sink_end_of_frame(&bsnk);
+        ok(rc == 0 && buffered_sink_pending(&bsd) == 10u,
+           "buffered: end of frame is ignored by default");
+        bsd.flags |= BUFFERED_SINK_FLUSH_ON_FRAME;
+        rc = sink_end_of_frame(&bsnk);
+        ok(rc == 0 && buffered_sink_pending(&bsd) == 0u,
+           "buffered: end of frame flushes with FLUSH_ON_FRAME");
+        rc = sink_put_chunk(&bsnk, isrc_bo.buffer.data + 10u, SRC_SIZE - 10u);
+        ok(rc == (ssize_t)(SRC_SIZE - 10u),
+           "buffered: large chunk bypasses buffer (%zd)", rc);
+        ok(isnk_bc.write.stat.accesses == 2u,
+           "buffered: two sink accesses in total (%zu)",
+           isnk_bc.write.stat.accesses);
+        cmp_mem(isrc_bo.buffer.data, isnk_bc.buffer.data, SRC_SIZE,
+                "buffered: chunk writes produce source data");
+    }
+
+    /*
+     * Vector endpoints take or produce whole sets of chunks in one access.
+     * All other kinds of endpoints can be used with the vector API as well,
+     * and vector endpoints can be used with all other APIs.
+     */
+
+    test_reset();
+    instrumentable_chunksize(&isnk_bv, SNK_SIZE);
+    instrumentable_chunksize(&isnk_bc, SNK_SIZE);
+    {
+        ByteBuffer chunk[] = { BYTE_BUFFER(src_bo,        100u),
+                               BYTE_BUFFER(src_bo + 100u, 0u),
+                               BYTE_BUFFER(src_bo + 100u, SRC_SIZE - 100u) };
+        ByteChunks v = BYTE_CHUNKS(chunk);
+        rc = sink_put_chunks(&snk_v, &v);
+        ok(rc == SRC_SIZE, "vector: chunks->v works (%zd)", rc);
+        ok(isnk_bv.write.stat.accesses == 1u,
+           "vector: chunks->v takes one access (%zu)",
+           isnk_bv.write.stat.accesses);
+        ok(v.active == v.chunks, "vector: all chunks were consumed");
+        cmp_mem(src_bo, snk_bv, SRC_SIZE,
+                "vector: chunks and sink(v) memory match");
+
+        v.active = 0u;
+        for (size_t i = 0u; i < v.chunks; ++i) {
+            chunk[i].offset = 0u;
+        }
+        rc = sink_put_chunks(&snk_c, &v);
+        ok(rc == SRC_SIZE, "vector: chunks->c works (%zd)", rc);
+        ok(isnk_bc.write.stat.accesses == 2u,
+           "vector: chunks->c takes one access per non-empty chunk (%zu)",
+           isnk_bc.write.stat.accesses);
+        cmp_mem(src_bo, snk_bc, SRC_SIZE,
+                "vector: chunks and sink(c) memory match");
+    }
+
+    test_reset();
+    {
+        static unsigned char buf[SRC_SIZE];
+        ByteBuffer chunk[] = { BYTE_BUFFER_EMPTY(buf,        10u),
+                               BYTE_BUFFER_EMPTY(buf + 10u,  SRC_SIZE - 10u) };
+        ByteChunks v = BYTE_CHUNKS(chunk);
+        rc = source_get_chunks(&src_v, &v);
+        ok(rc == SRC_SIZE, "vector: v->chunks works (%zd)", rc);
+        ok(isrc_bv.read.stat.accesses == (SRC_SIZE + 4u) / 5u,
+           "vector: v->chunks honours chunk size (%zu)",
+           isrc_bv.read.stat.accesses);
+        ok(chunk[0].used == 10u && chunk[1].used == SRC_SIZE - 10u,
+           "vector: all chunks were filled");
+        cmp_mem(src_bv, buf, SRC_SIZE,
+                "vector: source(v) and chunks memory match");
+    }
+
+    test_reset();
+    rc = sts_drain_aux(&src_v, &snk_o, &aux);
+    ok(rc == SRC_SIZE, "drain: v->o through aux works (%zd)", rc);
+    cmp_mem(isrc_bv.buffer.data, isnk_bo.buffer.data,
+            isrc_bv.buffer.size, "drain: Source(v) and sink(o) memory match");
+
+    test_reset();
+    rc = sts_drain_aux(&src_c, &snk_v, &aux);
+    ok(rc == SRC_SIZE, "drain: c->v through aux works (%zd)", rc);
+    cmp_mem(isrc_bc.buffer.data, isnk_bv.buffer.data,
+            isrc_bc.buffer.size, "drain: Source(c) and sink(v) memory match");
+
+    /*
+     * Reserve and commit let producers generate data straight into a sink's
+     * memory. Sinks without that ability use the caller's scratch memory.
+     */
+
+    test_reset();
+    {
+        static unsigned char mem[32u];
+        ByteBuffer b = BYTE_BUFFER_EMPTY(mem, sizeof(mem));
+        Sink bsnk;
+        void *p = NULL;
+        sink_to_buffer(&bsnk, &b);
+        rc = sink_reserve(&bsnk, NULL, &p, 4u, 100u);
+        ok(rc == 32 && p == mem,
+           "reserve: buffer sink offers its own memory (%zd)", rc);
+        memcpy(p, src_bo, 10u);
+        rc = sink_commit(&bsnk, p, 10u);
+        ok(rc == 10 && b.used == 10u,
+           "reserve: commit accounts for data in place (%zd)", rc);
+        cmp_mem(src_bo, mem, 10u, "reserve: buffer sink holds data");
+        rc = sink_reserve(&bsnk, NULL, &p, 23u, 100u);
+        ok(rc == -ENOMEM, "reserve: too little room is -ENOMEM (%zd)", rc);
+        rc = sink_reserve(&bsnk, NULL, &p, 5u, 4u);
+        ok(rc == -EINVAL, "reserve: min > max is -EINVAL (%zd)", rc);
+    }
+
+    test_reset();
+    instrumentable_chunksize(&isnk_bc, SNK_SIZE);
+    {
+        static unsigned char scratchb[16u];
+        ByteBuffer scratch = BYTE_BUFFER_EMPTY(scratchb, sizeof(scratchb));
+        void *p = NULL;
+        rc = sink_reserve(&snk_o, &scratch, &p, 2u, 100u);
+        ok(rc == 16 && p == scratchb,
+           "reserve: octet sink falls back to scratch (%zd)", rc);
+        memcpy(p, src_bc, 16u);
+        rc = sink_commit(&snk_o, p, 16u);
+        ok(rc == 16, "reserve: commit copies scratch to sink (%zd)", rc);
+        cmp_mem(src_bc, snk_bo, 16u, "reserve: octet sink holds data");
+        rc = sink_reserve(&snk_o, &scratch, &p, 17u, 100u);
+        ok(rc == -ENOMEM, "reserve: scratch too small is -ENOMEM (%zd)", rc);
+
+        ByteBuffer wc = BYTE_BUFFER_EMPTY(wcb, WC_SIZE);
+        BufferedSink bsd = BUFFERED_SINK(&snk_c, &wc, 0u);
+        Sink bsnk;
+        buffered_sink_init(&bsnk, &bsd);
+        rc = sink_put_chunk(&bsnk, src_bo, WC_SIZE - 4u);
+        rc = sink_reserve(&bsnk, &scratch, &p, 8u, 8u);
+        ok(rc == 8 && p == wcb,
+           "reserve: buffered sink flushes to make room (%zd)", rc);
+        ok(isnk_bc.write.stat.accesses == 1u,
+           "reserve: buffered sink flushed once (%zu)",
+           isnk_bc.write.stat.accesses);
+        memcpy(p, src_bo + WC_SIZE - 4u, 8u);
+        rc = sink_commit(&bsnk, p, 8u);
+        ok(rc == 8 && buffered_sink_pending(&bsd) == 8u,
+           "reserve: buffered sink holds committed data (%zd)", rc);
+        rc = sink_flush(&bsnk);
+        cmp_mem(src_bo, snk_bc, WC_SIZE + 4u,
+                "reserve: buffered sink passes on all data");
+
+        /* Committing into the last free octets flushes the buffer right
+         * away. If the wrapped sink fails, the data is queued nonetheless,
+         * so the commit succeeds. The caller learns about the error with its
+         * next put or flush, and the data is passed on exactly once. */
+        instrumentable_until_error_at(&isnk_bc.write.error, 0u, -EIO);
+        rc = sink_reserve(&bsnk, &scratch, &p, WC_SIZE, WC_SIZE);
+        memcpy(p, src_bc, WC_SIZE);
+        rc = sink_commit(&bsnk, p, WC_SIZE);
+        ok(rc == (ssize_t)WC_SIZE && buffered_sink_pending(&bsd) == WC_SIZE,
+           "reserve: commit into full buffer queues data (%zd)", rc);
+        rc = sink_flush(&bsnk);
+        ok(rc == -EIO && buffered_sink_pending(&bsd) == WC_SIZE,
+           "reserve: failing flush of full buffer is signalled (%zd)", rc);
+        instrumentable_reset_error(&isnk_bc.write.error);
+        rc = sink_flush(&bsnk);
+        ok(rc == 0 && buffered_sink_pending(&bsd) == 0u,
+           "reserve: later flush passes on queued data (%zd)", rc);
+        cmp_mem(src_bc, snk_bc + WC_SIZE + 4u, WC_SIZE,
+                "reserve: queued data is passed on once");
+    }
+
+#if defined(UFW_HAVE_POSIX_READV) && defined(UFW_HAVE_POSIX_WRITEV)
+    {
+        int fds[2];
+        if (pipe(fds) == 0) {
+            static unsigned char buf[256u];
+            Source psrc;
+            Sink psnk;
+            source_from_filedesc_vector(&psrc, fds + 0);
+            sink_to_filedesc_vector(&psnk, fds + 1);
+            ByteBuffer out[] = { BYTE_BUFFER(src_bo,       16u),
+                                 BYTE_BUFFER(src_bo + 16u, 240u) };
+            ByteChunks vo = BYTE_CHUNKS(out);
+            rc = sink_put_chunks(&psnk, &vo);
+            ok(rc == 256, "vector: writev() into pipe works (%zd)", rc);
+            ByteBuffer in[] = { BYTE_BUFFER_EMPTY(buf,        100u),
+                                BYTE_BUFFER_EMPTY(buf + 100u, 156u) };
+            ByteChunks vi = BYTE_CHUNKS(in);
+            rc = source_get_chunks(&psrc, &vi);
+            ok(rc == 256, "vector: readv() from pipe works (%zd)", rc);
+            cmp_mem(src_bo, buf, 256u, "vector: pipe transfers data intact");
+            close(fds[0]);
+            close(fds[1]);
+        }
+    }
+#endif /* UFW_HAVE_POSIX_READV && UFW_HAVE_POSIX_WRITEV */
+
     noplan();
     return EXIT_SUCCESS;
 }
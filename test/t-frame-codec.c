@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 ufw workers, All rights reserved.
+ *
+ * Terms for redistribution and use can be found in LICENCE.
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ufw/compat/errno.h>
+
+#include <ufw/byte-buffer.h>
+#include <ufw/compiler.h>
+#include <ufw/endpoints.h>
+#include <ufw/frame-codec.h>
+
+#include <ufw/test/tap.h>
+
+#define MEMORY_SIZE (512ul)
+
+static unsigned char wire_memory[MEMORY_SIZE];
+static unsigned char sink_memory[MEMORY_SIZE];
+static unsigned char frame_memory[MEMORY_SIZE];
+
+static const FrameCodec *codecs[] = {
+    &frame_codec_slip,
+    &frame_codec_slip_with_sof,
+    &frame_codec_cobs,
+    &frame_codec_lenp_variable,
+    &frame_codec_lenp_octet,
+    &frame_codec_lenp_le16,
+    &frame_codec_lenp_le32,
+    &frame_codec_lenp_be16,
+    &frame_codec_lenp_be32
+};
+
+#define CODECS (sizeof(codecs) / sizeof(*codecs))
+
+/* The payload contains the control characters of all codecs. */
+static unsigned char head[] = { 'h', 'd', 'r' };
+static unsigned char body[] = { 0x00, 'a', 0xc0, 'b', 0xdb, 0xdc, 0xdd, 0x00 };
+static unsigned char tail[] = { 't', 'a', 'i', 'l' };
+static unsigned char payload[] = {
+    'h', 'd', 'r',
+    0x00, 'a', 0xc0, 'b', 0xdb, 0xdc, 0xdd, 0x00,
+    't', 'a', 'i', 'l' };
+
+typedef struct FeedResult {
+    size_t frames;
+    size_t good;
+    int status;
+} FeedResult;
+
+static int
+check_frame(void *arg, ByteBuffer *frame, int status)
+{
+    FeedResult *r = arg;
+    r->frames++;
+    r->status = status;
+    if (status == 0 && frame->used == sizeof(payload)
+        && memcmp(frame->data, payload, sizeof(payload)) == 0)
+    {
+        r->good++;
+    }
+    return 0;
+}
+
+int
+main(UNUSED int argc, UNUSED char **argv)
+{
+    plan(3 * CODECS + 3);
+
+    for (size_t i = 0u; i < CODECS; ++i) {
+        const FrameCodec *c = codecs[i];
+        FrameCodecState state;
+        ByteBuffer wire;
+        Sink sink;
+        Source source;
+
+        /* Encode */
+        ByteBuffer chunk[] = {
+            BYTE_BUFFER(head, sizeof(head)),
+            BYTE_BUFFER(body, sizeof(body)),
+            BYTE_BUFFER(tail, sizeof(tail)) };
+        ByteChunks chunks = BYTE_CHUNKS(chunk);
+        byte_buffer_space(&wire, wire_memory, MEMORY_SIZE);
+        sink_to_buffer(&sink, &wire);
+        int rc = frame_codec_encode_chunks(c, &chunks, &sink);
+        const size_t overhead = wire.used - sizeof(payload);
+        ok(rc == 0 && wire.used >= sizeof(payload)
+           && overhead <= frame_codec_max_overhead(c, sizeof(payload)),
+           "%s: encode works, overhead %zu is in bounds", c->name, overhead);
+
+        /* Decode from a source */
+        ByteBuffer out;
+        byte_buffer_space(&out, sink_memory, MEMORY_SIZE);
+        sink_to_buffer(&sink, &out);
+        ByteBuffer in = wire;
+        source_from_buffer(&source, &in);
+        frame_codec_init(c, &state);
+        rc = frame_codec_decode_into(c, &state, &source, &sink);
+        ok(rc == 0 && out.used == sizeof(payload)
+           && memcmp(out.data, payload, sizeof(payload)) == 0,
+           "%s: decode_into works", c->name);
+
+        /* Feed two frames octet by octet; decoder state persists. */
+        ByteBuffer frame = BYTE_BUFFER_EMPTY(frame_memory, MEMORY_SIZE);
+        FeedResult r = { 0u, 0u, 0 };
+        frame_codec_init(c, &state);
+        for (size_t n = 0u; n < 2u; ++n) {
+            for (size_t k = 0u; k < wire.used; ++k) {
+                (void)frame_codec_feed(c, &state, wire.data + k, 1u,
+                                       &frame, check_frame, &r);
+            }
+        }
+        ok(r.frames == 2u && r.good == 2u,
+           "%s: feed works across calls (%zu/%zu)", c->name, r.good, r.frames);
+    }
+
+    ok(frame_codec_lenp(LENP_BE_16BIT) == &frame_codec_lenp_be16
+       && frame_codec_lenp(LENP_VARIABLE) == &frame_codec_lenp_variable,
+       "frame_codec_lenp() finds length prefix codecs");
+
+    {
+        /* Too large for the frame buffer, followed by a valid frame */
+        static unsigned char data[] = { 5, 'a', 'b', 'c', 'd', 'e',
+                                        2, 'x', 'y' };
+        static unsigned char fmem[4];
+        ByteBuffer frame = BYTE_BUFFER_EMPTY(fmem, sizeof(fmem));
+        LengthPrefixContext ctx;
+        FeedResult r = { 0u, 0u, 0 };
+        flenp_context_init(&ctx, LENP_OCTET);
+        (void)flenp_decode_feed(&ctx, data, 3u, &frame, check_frame, &r);
+        const int first = r.status;
+        (void)flenp_decode_feed(&ctx, data + 3u, sizeof(data) - 3u,
+                                &frame, check_frame, &r);
+        ok(r.frames == 2u && first == -ENOBUFS && r.status == 0
+           && memcmp(fmem, "xy", 2u) == 0,
+           "lenp feed skips frames that are too large");
+
+        /* Overlong variable-length integer */
+        static unsigned char overlong[] = {
+            0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80 };
+        memset(&r, 0, sizeof(r));
+        flenp_context_init(&ctx, LENP_VARIABLE);
+        (void)flenp_decode_feed(&ctx, overlong, sizeof(overlong),
+                                &frame, check_frame, &r);
+        ok(r.frames == 1u && r.status == -EILSEQ,
+           "lenp feed rejects overlong prefix");
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -24,6 +24,7 @@
 #include <ufw/byte-buffer.h>
 #include <ufw/compat/errno.h>
 #include <ufw/compiler.h>
+#include <ufw/endpoints.h>
 #include <ufw/length-prefix.h>
 #include <ufw/test/tap.h>
 
@@ -202,13 +203,42 @@ t_fixint_prefix(void)
     }
 }
 
+static void
+t_chunks_prefix(void)
+{
+    memset(wire, 0, WIRE_SIZE);
+    for (size_t i = 0u; i < MEM_SIZE; ++i) {
+        mema[i] = i & 0xffu;
+    }
+
+    ByteBuffer chunk[] = { BYTE_BUFFER(mema,        100u),
+                           BYTE_BUFFER(mema + 100u, 200u) };
+    ByteChunks oc = BYTE_CHUNKS(chunk);
+    InstrumentableBuffer ib = INSTRUMENTABLE_BUFFER(wire, WIRE_SIZE);
+    Sink sink;
+    instrumentable_sink(DATA_KIND_VECTOR, &sink, &ib);
+    instrumentable_chunksize(&ib, WIRE_SIZE);
+
+    const ssize_t n = lenp_chunks_to_sink(&sink, &oc);
+    ok(n == 302, "lenp,vector: Prefix+payload size is correct (%zd)", n);
+    ok(ib.write.stat.accesses == 1u,
+       "lenp,vector: Frame is written in one access (%zu)",
+       ib.write.stat.accesses);
+    cmp_mem(wire, ((unsigned char[]){0xacu, 0x02u}), 2,
+            "lenp,vector: Prefix is correct");
+    cmp_mem(wire + 2, mema, 300u, "lenp,vector: Encoded memory is correct");
+    ok(oc.active == 0u && chunk[0].offset == 0u && chunk[1].offset == 0u,
+       "lenp,vector: Input chunks are left untouched");
+}
+
 int
 main(UNUSED int argc, UNUSED char *argv[])
 {
-    plan(14 + 29);
+    plan(14 + 29 + 5);
 
     t_varint_prefix(); /* 14 */
     t_fixint_prefix(); /* 29 */
+    t_chunks_prefix(); /*  5 */
 
     return EXIT_SUCCESS;
 }
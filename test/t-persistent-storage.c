@@ -13,6 +13,8 @@
 #include <ufw/compiler.h>
 #include <ufw/test/tap.h>
 
+#include <ufw/crc/crc16-arc.h>
+#include <ufw/crc/crc32c.h>
 #include <ufw/persistent-storage.h>
 
 #define BUFFER_SIZE 128u
@@ -113,16 +115,74 @@ t_simple_store(unsigned char *b, size_t n, bool corrupt)
     ok(foo == set1.a, "foo has correct value");
 }
 
+static uint16_t
+crc16(const unsigned char *data, size_t n, uint16_t init)
+{
+    return ufw_crc16_arc(init, data, n);
+}
+
+static void
+t_incremental_store(unsigned char *b, size_t n, bool wide)
+{
+    PersistentAccess success;
+    PersistentStorage store;
+
+    t_init();
+
+    persistent_init(&store, sizeof(struct cfg), buffer_read, buffer_write);
+    if (wide) {
+        persistent_sum32(&store, ufw_crc32c_persistent, CRC32C_INITIAL);
+        persistent_sum32_zeros(&store, ufw_crc32c_zeros);
+    } else {
+        persistent_sum16(&store, crc16, 0xffffu);
+        persistent_sum16_zeros(&store, ufw_crc16_arc_zeros);
+    }
+
+    if (b != NULL)
+        persistent_buffer(&store, b, n);
+
+    success = persistent_store(&store, &set1);
+    unless (ok(success == PERSISTENT_ACCESS_SUCCESS, "set1 was stored")) {
+        pru16(success, PERSISTENT_ACCESS_SUCCESS);
+    }
+
+    set1.b = 9876.54;
+    success = persistent_store_part(&store, &set1.b, offsetof(struct cfg, b),
+                                    sizeof(set1.b));
+    unless (ok(success == PERSISTENT_ACCESS_SUCCESS,
+               "part was stored incrementally")) {
+        pru16(success, PERSISTENT_ACCESS_SUCCESS);
+    }
+
+    success = persistent_validate(&store);
+    unless (ok(success == PERSISTENT_ACCESS_SUCCESS, "Stored data validated")) {
+        pru16(success, PERSISTENT_ACCESS_SUCCESS);
+    }
+
+    /* An incremental update keeps corrupted data from validating. */
+    buffer[store.data.address] ^= 0x01u;
+    (void)persistent_store_part(&store, &set1.c, offsetof(struct cfg, c),
+                                sizeof(set1.c));
+    success = persistent_validate(&store);
+    unless (ok(success == PERSISTENT_ACCESS_INVALID_DATA,
+               "Corrupted data still fails to validate")) {
+        pru16(success, PERSISTENT_ACCESS_INVALID_DATA);
+    }
+}
+
 int
 main(UNUSED int argc, UNUSED char *argv[])
 {
     unsigned char b[8u];
-    plan(6 + 6 + 2 + 2);
+    plan(6 + 6 + 2 + 2 + 4 + 4 + 4);
 
     t_simple_store(NULL, 0u, false);                   /* 6 */
     t_simple_store(b, sizeof(b) / sizeof(*b), false);  /* 6 */
     t_simple_store(NULL, 0u, true);                    /* 2 */
     t_simple_store(b, sizeof(b) / sizeof(*b), true);   /* 2 */
+    t_incremental_store(NULL, 0u, false);              /* 4 */
+    t_incremental_store(b, sizeof(b) / sizeof(*b), false); /* 4 */
+    t_incremental_store(b, sizeof(b) / sizeof(*b), true);  /* 4 */
 
     return EXIT_SUCCESS;
 }
@@ -9,12 +9,16 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <ufw/compat/errno.h>
+
 #include <ufw/compiler.h>
 #include <ufw/toolchain.h>
 
 #include <ufw/binary-format.h>
 #include <ufw/endpoints.h>
+#include <ufw/frame-codec.h>
 #include <ufw/register-protocol.h>
+#include <ufw/rfc1055.h>
 
 #include <ufw/test/tap.h>
 
@@ -175,8 +179,29 @@ t_setup(const bool trace, const RPMemoryType mtype,
 #endif /* WITH_UINT8_T */
     }
 
-    remote->ep.type = eptype;
-    local->ep.type = eptype;
+    regp_use_channel(remote, eptype, remote->ep.source, remote->ep.sink);
+    regp_use_channel(local, eptype, local->ep.source, local->ep.sink);
+}
+
+/*
+ * Frame callback for regp_feed(): Process each frame right away.
+ */
+static int
+t_feed_frame(void *arg, ByteBuffer *frame, int status)
+{
+    RegP *p = arg;
+    RPMaybeFrame mf;
+    if (status < 0) {
+        return status;
+    }
+    int rc = regp_recv_frame(p, &mf, frame->data, frame->used);
+    if (rc == 0 && mf.error.id == 0 && regp_is_read_request(mf.frame)) {
+        rc = regp_process(p, &mf);
+    } else if (rc == 0) {
+        rc = -EBADMSG;
+    }
+    regp_free(p, mf.frame);
+    return rc;
 }
 
 int
@@ -208,7 +233,7 @@ main(UNUSED int argc, UNUSED char *argv[])
     regp_use_channel(local,  RP_EP_TCP, r2l_source, l2r_sink);
     regp_use_channel(remote, RP_EP_TCP, l2r_source, r2l_sink);
 
-    plan(54
+    plan(80
 #ifdef USE_CHECK_WIRE
          + (2 * 8)
 #endif /* USE_CHECK_WIRE */
@@ -564,6 +589,161 @@ main(UNUSED int argc, UNUSED char *argv[])
         ok(byte_buffer_rest(&r2l_buffer.buffer) == 0u,
            "channel: remote-to-local is empty");
     }
+
+    /* The same transaction, with COBS instead of SLIP framing. */
+    printf("# === Switching Endpoint Kind to Serial with COBS ===\n");
+    t_setup(false, RP_MEMTYPE_16, RP_EP_SERIAL_COBS);
+
+    {
+        RPMaybeFrame mf;
+        int rc;
+        rc = regp_req_read16(remote, 100, 1);
+        okrc("remote: Sending read request signals success");
+        ByteBuffer *wire = &r2l_buffer.buffer;
+        const unsigned char *delim = memchr(byte_buffer_readptr(wire), 0,
+                                            byte_buffer_rest(wire));
+        ok(delim == wire->data + wire->used - 1u,
+           "remote: COBS frame contains no zero but its delimiter");
+        rc = regp_recv(local, &mf);
+        okrc("local: Receiving read request signals success");
+        okmf("local");
+        rc = regp_process(local, &mf);
+        okrc("local: Processing read request signals success");
+        regp_free(local, mf.frame);
+        rc = regp_recv(remote, &mf);
+        okrc("remote: Receiving read response signals success");
+        okmf("remote");
+        with_good_mf(mf) {
+            const uint16_t datum = bf_ref_u16l(mf.frame->payload.data);
+            ok(datum == 100u, "remote: Payload has expected value (100)");
+        }
+
+        regp_free(remote, mf.frame);
+
+        ok(byte_buffer_rest(&l2r_buffer.buffer) == 0u,
+           "channel: local-to-remote is empty");
+        ok(byte_buffer_rest(&r2l_buffer.buffer) == 0u,
+           "channel: remote-to-local is empty");
+    }
+
+    /* The framing can be changed independently of the endpoint type. Here,
+     * local receives data in small pieces, as it would with non-blocking
+     * reads, and the decoder state persists between them. */
+    printf("# === Length Prefix Codec with Partial Reads ===\n");
+    t_setup(false, RP_MEMTYPE_16, RP_EP_TCP);
+    regp_use_codec(local, &frame_codec_lenp_be16);
+    regp_use_codec(remote, &frame_codec_lenp_be16);
+
+    {
+        static unsigned char fmem[64];
+        ByteBuffer frame = BYTE_BUFFER_EMPTY(fmem, sizeof(fmem));
+        RPMaybeFrame mf;
+        int rc;
+        rc = regp_req_read16(remote, 100, 1);
+        ByteBuffer *wire = &r2l_buffer.buffer;
+        const size_t n = byte_buffer_rest(wire);
+        ok(rc == 0 && n > 2u
+           && bf_ref_u16b(byte_buffer_readptr(wire)) == n - 2u,
+           "remote: Frame carries a 16 bit big endian prefix");
+        ssize_t frc = 0;
+        for (size_t i = 0u; i < n && frc >= 0; i += 3u) {
+            const size_t m = (n - i) < 3u ? (n - i) : 3u;
+            frc = regp_feed(local, wire->data + wire->offset + i, m,
+                            &frame, t_feed_frame, local);
+        }
+        wire->offset += n;
+        ok(frc >= 0, "local: Feeding request in pieces signals success");
+        rc = regp_recv(remote, &mf);
+        okrc("remote: Receiving read response signals success");
+        okmf("remote");
+        with_good_mf(mf) {
+            const uint16_t datum = bf_ref_u16l(mf.frame->payload.data);
+            ok(datum == 100u, "remote: Payload has expected value (100)");
+        }
+        regp_free(remote, mf.frame);
+    }
+
+    /* A server may extract a burst of frames from the wire in one go, and
+     * then hand them to the protocol one by one. */
+    printf("# === Burst of Frames via rfc1055_decode_frames() ===\n");
+    t_setup(false, RP_MEMTYPE_16, RP_EP_SERIAL);
+
+    {
+        RPMaybeFrame mf;
+        RFC1055Span span[4];
+        RFC1055Context slip = RFC1055_CONTEXT_INIT_DEFAULT;
+        size_t consumed = 0u;
+        int rc;
+        rc = regp_req_read16(remote, 100, 1);
+        rc |= regp_req_read16(remote, 200, 1);
+        ByteBuffer *wire = &r2l_buffer.buffer;
+        const ssize_t frames =
+            rfc1055_decode_frames(&slip, byte_buffer_readptr(wire),
+                                  byte_buffer_rest(wire), span, 4u,
+                                  &consumed);
+        ok(rc == 0 && frames == 2 && consumed == byte_buffer_rest(wire),
+           "burst: Two frames extracted from wire (%zd)", frames);
+        wire->offset += consumed;
+
+        for (ssize_t i = 0; i < frames; ++i) {
+            const unsigned char *f = wire->data + span[i].offset;
+            rc = regp_recv_frame(local, &mf, f, span[i].length);
+            ok(rc == 0 && mf.error.id == 0 && regp_is_read_request(mf.frame),
+               "burst: local: Frame %zd is a valid read request", i);
+            rc = regp_process(local, &mf);
+            okrc("burst: local: Processing read request signals success");
+            regp_free(local, mf.frame);
+        }
+
+        for (unsigned int i = 0u; i < 2u; ++i) {
+            rc = regp_recv(remote, &mf);
+            with_good_mf(mf) {
+                const uint16_t datum = bf_ref_u16l(mf.frame->payload.data);
+                ok(rc == 0 && datum == 100u * (i + 1u),
+                   "burst: remote: Payload has expected value (%u)", datum);
+            }
+            regp_free(remote, mf.frame);
+        }
+    }
+
+    /* The payload checksum of received frames is derived from the checksum
+     * the receive sink computes while storing them. */
+    printf("# === Payload Checksum Verification ===\n");
+    t_setup(false, RP_MEMTYPE_16, RP_EP_SERIAL);
+
+    {
+        static const uint16_t payload[8] = {
+            0x1111u, 0x2222u, 0x3333u, 0x4444u,
+            0x5555u, 0x6666u, 0x7777u, 0x1111u };
+        ByteBuffer *wire = &r2l_buffer.buffer;
+        RPMaybeFrame mf;
+        int rc;
+
+        rc = regp_req_write16(remote, 16, 8, payload);
+        rc |= regp_recv(local, &mf);
+        ok(rc == 0 && mf.error.id == 0 && regp_is_write_request(mf.frame),
+           "local: Intact payload is accepted");
+        rc = regp_process(local, &mf);
+        regp_free(local, mf.frame);
+        ok(rc == 0 && memcmp(memory16 + 16, payload, sizeof(payload)) == 0,
+           "local: Payload was written to memory");
+        rc = regp_recv(remote, &mf);
+        regp_free(remote, mf.frame);
+
+        rc = regp_req_write16(remote, 32, 8, payload);
+        /* Last payload octet, right before the end-of-frame marker */
+        wire->data[wire->used - 2u] ^= 0x01u;
+        rc |= regp_recv(local, &mf);
+        ok(rc == 0 && mf.error.id == EPROTO,
+           "local: Damaged payload is detected");
+        rc = regp_process(local, &mf);
+        regp_free(local, mf.frame);
+        rc |= regp_recv(remote, &mf);
+        ok(rc == 0 && mf.error.id == 0 && regp_is_write_response(mf.frame)
+           && mf.frame->header.meta.response == RP_RESP_EPAYLOADCRC,
+           "remote: Damaged write is rejected with EPAYLOADCRC");
+        regp_free(remote, mf.frame);
+    }
     /* NOLINTEND(concurrency-mt-unsafe) */
 
     return EXIT_SUCCESS;
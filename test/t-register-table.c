@@ -814,7 +814,8 @@ t_hexstring(void)
             REG_U16(2, 0x0002ul, 0u),
             REG_U16(3, 0x0003ul, 0u),
             REGISTER_ENTRY_END
-        }
+        },
+        .dirty = REGISTER_DIRTY_MAP(4u)
     };
 
     RegisterInit success = register_init(&regs);
@@ -824,6 +825,9 @@ t_hexstring(void)
     uint16_t expect[] = { 0x1234u, 0x5678u, 0x9abcu, 0x0000u };
     cmp_mem(regs.area->mem, expect, 4u * sizeof(uint16_t),
             "hexstr sets up memory correctly.");
+    ok(register_is_dirty(&regs, 0u) && register_is_dirty(&regs, 2u)
+       && register_is_dirty(&regs, 3u) == false,
+       "hexstr: marks the entries it changed");
 }
 
 static void
@@ -975,6 +979,919 @@ t_iterate_miss(void)
     }
 }
 
+static int
+f_cb_count(UNUSED RegisterTable *t, UNUSED RegisterHandle h, void *arg)
+{
+    unsigned int *count = arg;
+    *count += 1u;
+    return 0;
+}
+
+static void
+t_many_areas(void)
+{
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            MEMORY_AREA(0x0000ul, 0x04ul),
+            MEMORY_AREA(0x0004ul, 0x04ul),
+            MEMORY_AREA(0x0010ul, 0x04ul),
+            MEMORY_AREA(0x0014ul, 0x04ul),
+            MEMORY_AREA(0x0100ul, 0x08ul),
+            REGISTER_AREA_END
+        },
+        .entry = (RegisterEntry[]) {
+            REG_U16(0, 0x0000ul, 0u),
+            REG_U32(1, 0x0002ul, 0x11111111ul),
+            REG_U16(2, 0x0005ul, 0x2222u),
+            REG_U32(3, 0x0006ul, 0x33333333ul),
+            REG_U16(4, 0x0011ul, 0x4444u),
+            REG_U32(5, 0x0014ul, 0x55555555ul),
+            REG_U16(6, 0x0102ul, 0x6666u),
+            REG_U16(7, 0x0107ul, 0x7777u),
+            REGISTER_ENTRY_END
+        }
+    };
+
+    RegisterInit success = register_init(&t);
+    cmp_code(success.code, ==, REG_INIT_SUCCESS, "many-areas: t initialises");
+    for (RegisterHandle r = 0u; r < t.entries; ++r) {
+        register_untouch(&t, r);
+    }
+
+    /* Spans two adjacent areas, touching parts of three entries. */
+    RegisterAtom buf[4];
+    bf_set_u16l(buf + 0u, 0xaaaau);
+    bf_set_u16l(buf + 1u, 0xbbbbu);
+    bf_set_u16l(buf + 2u, 0xccccu);
+    bf_set_u16l(buf + 3u, 0xddddu);
+    RegisterAccess acc = register_block_write(&t, 0x0003ul, 4u, buf);
+    cmp_code(acc.code, ==, REG_ACCESS_SUCCESS,
+             "many-areas: write across areas works");
+
+    RegisterValue v;
+    register_get(&t, 1u, &v);
+    cmp_code(v.value.u32, ==, 0xaaaa1111ul, "many-areas: entry 1 updated");
+    register_get(&t, 2u, &v);
+    cmp_code(v.value.u16, ==, 0xccccu, "many-areas: entry 2 updated");
+    register_get(&t, 3u, &v);
+    cmp_code(v.value.u32, ==, 0x3333ddddul, "many-areas: entry 3 updated");
+    ok(register_was_touched(&t, 0u) == false
+       && register_was_touched(&t, 1u)
+       && register_was_touched(&t, 2u)
+       && register_was_touched(&t, 3u)
+       && register_was_touched(&t, 4u) == false,
+       "many-areas: exactly the written entries are touched");
+
+    /* Runs off the end of the second pair of adjacent areas. */
+    acc = register_block_write(&t, 0x0016ul, 4u, buf);
+    cmp_code(acc.code, ==, REG_ACCESS_NOENTRY,
+             "many-areas: write into hole fails");
+    cmp_code(acc.address, ==, 0x0018ul,
+             "many-areas: hole address is correct");
+
+    unsigned int count = 0u;
+    acc = register_foreach_in(&t, 0x0005ul, 0x0102ul, f_cb_count, &count);
+    cmp_code(acc.code, ==, REG_ACCESS_SUCCESS,
+             "many-areas: iteration succeeds");
+    cmp_code(count, ==, 5u, "many-areas: iteration visits entries 2 to 6");
+}
+
+typedef enum ImageRegister {
+    IMG_VERSION,
+    IMG_SERIAL,
+    IMG_OFFSET,
+    IMG_FACTOR,
+    IMG_CHECKED
+} ImageRegister;
+
+static unsigned int img_checks = 0u;
+
+static bool
+img_check(UNUSED const RegisterEntry *e, UNUSED RegisterValue v)
+{
+    img_checks++;
+    return true;
+}
+
+/*
+ * The first two areas carry images of the serialised default values of the
+ * entries they hold. The third one holds an entry with a callback validator,
+ * which has to be set up entry by entry.
+ */
+
+static const RegisterAtom image_table_image_0[0x0010ul] = {
+    REG_ATOM_LE(0x01abu), REG_ATOM_LE(0x5678u), REG_ATOM_LE(0x1234u),
+    REG_ATOM_LE(0xfffeu)
+};
+
+static const RegisterAtom image_table_image_1[0x0008ul] = {
+    REG_ATOM_LE(0x51ecu), REG_ATOM_LE(0xc1bcu)
+};
+
+RegisterTable image_table = {
+    .area = (RegisterArea[]) {
+        IMAGE_AREA(0x0000ul, 0x0010ul, image_table_image_0),
+        IMAGE_AREA_RO(0x0010ul, 0x0008ul, image_table_image_1),
+        MEMORY_AREA(0x0100ul, 0x0008ul),
+        REGISTER_AREA_END
+    },
+    .entry = (RegisterEntry[]) {
+        REG_U16(IMG_VERSION, 0x0000ul, 0x01abu),
+        REG_U32(IMG_SERIAL, 0x0001ul, 0x12345678ul),
+        REG_S16(IMG_OFFSET, 0x0003ul, -2),
+        REG_F32RANGE(IMG_FACTOR, 0x0010ul, -100.F, 100.F, -23.54F),
+        REG_U16FNC(IMG_CHECKED, 0x0100ul, img_check, 0x0017u),
+        REGISTER_ENTRY_END
+    }
+};
+
+static void
+t_default_image(void)
+{
+    RegisterInit success = register_init(&image_table);
+    cmp_code(success.code, ==, REG_INIT_SUCCESS, "image: table initialises");
+
+    /* Only the entry outside of the images is set up entry by entry. */
+    cmp_code(img_checks, ==, 1u, "image: only IMG_CHECKED was validated");
+    cmp_mem(image_table.area[0].mem, image_table_image_0,
+            0x10u * sizeof(RegisterAtom), "image: area 0 matches its image");
+
+    bool defaults = true;
+    for (RegisterHandle r = 0u; r < image_table.entries; ++r) {
+        RegisterValue cur, def;
+        register_get(&image_table, r, &cur);
+        register_default(&image_table, r, &def);
+        defaults = defaults && register_value_compare(&cur, &def);
+    }
+    ok(defaults, "image: all entries hold their default values");
+
+    RegisterValue v = { .type = REG_TYPE_FLOAT32, .value.f32 = 200.F };
+    RegisterAccess acc = register_set(&image_table, IMG_FACTOR, v);
+    cmp_code(acc.code, ==, REG_ACCESS_RANGE,
+             "image: entries in images are still validated");
+
+    /* An image that disagrees with an entry's default is refused. */
+    image_table.entry[IMG_OFFSET].default_value.s16 = -3;
+    success = register_init(&image_table);
+    image_table.entry[IMG_OFFSET].default_value.s16 = -2;
+    ok(success.code == REG_INIT_ENTRY_IMAGE_MISMATCH
+       && success.pos.entry == IMG_OFFSET,
+       "image: stale images fail initialisation");
+}
+
+#define DIRTY_ENTRIES 40u
+
+static void
+t_dirty_tracking(void)
+{
+    RegisterEntry entries[DIRTY_ENTRIES + 1u];
+    for (RegisterHandle i = 0u; i < DIRTY_ENTRIES; ++i) {
+        entries[i] = (RegisterEntry) { .type = REG_TYPE_UINT16,
+                                       .address = i,
+                                       .check.type = REGV_TYPE_TRIVIAL };
+    }
+    entries[DIRTY_ENTRIES] = (RegisterEntry)REGISTER_ENTRY_END;
+
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            MEMORY_AREA(0x0000ul, 0x40ul),
+            REGISTER_AREA_END
+        },
+        .entry = entries,
+        .dirty = REGISTER_DIRTY_MAP(DIRTY_ENTRIES)
+    };
+
+    RegisterInit success = register_init(&t);
+    cmp_code(success.code, ==, REG_INIT_SUCCESS, "dirty: t initialises");
+    ok(register_dirty_epoch(&t) == 0u && register_is_dirty(&t, 0u) == false,
+       "dirty: loading defaults does not mark entries");
+
+    const RegisterValue v = { .type = REG_TYPE_UINT16, .value.u16 = 23u };
+    register_set(&t, 35u, v);
+    register_set(&t, 3u, v);
+    ok(register_is_dirty(&t, 3u) && register_is_dirty(&t, 35u)
+       && register_is_dirty(&t, 4u) == false,
+       "dirty: register_set() marks entries");
+
+    RegisterAtom buf[2] = { 0u, 0u };
+    register_block_write(&t, 31u, 2u, buf);
+    ok(register_is_dirty(&t, 31u) && register_is_dirty(&t, 32u)
+       && register_is_dirty(&t, 30u) == false,
+       "dirty: register_block_write() marks entries");
+
+    RegisterDirtyWord snapshot[REGISTER_DIRTY_WORDS(DIRTY_ENTRIES)];
+    const uint32_t epoch = register_dirty_snapshot(&t, snapshot, 2u);
+    cmp_code(epoch, ==, 4u, "dirty: every change advances the epoch");
+
+    const RegisterHandle expect[] = { 3u, 31u, 32u, 35u };
+    RegisterDirtyIter it;
+    RegisterHandle r;
+    size_t n = 0u;
+    bool good = true;
+    register_dirty_iter(&it, snapshot, 2u);
+    while (register_dirty_next(&it, &r)) {
+        good = good && n < 4u && expect[n] == r;
+        n++;
+    }
+    ok(good && n == 4u, "dirty: iteration yields changed entries in order");
+    ok(register_is_dirty(&t, 3u) == false && register_is_dirty(&t, 35u) == false,
+       "dirty: snapshot clears the table's map");
+
+    t.dirty.words = 1u;
+    success = register_init(&t);
+    cmp_code(success.code, ==, REG_INIT_DIRTY_MAP_TOO_SMALL,
+             "dirty: init rejects a map that is too small");
+}
+
+static RegisterAtom many_backing[0x20u];
+static unsigned int many_reads = 0u;
+static unsigned int many_writes = 0u;
+
+static RegisterAccess
+many_read(const RegisterArea *a, RegisterAtom *dest,
+          RegisterOffset offset, RegisterOffset n)
+{
+    RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+    (void)a;
+    many_reads++;
+    memcpy(dest, many_backing + offset, n * sizeof(RegisterAtom));
+    return rv;
+}
+
+static RegisterAccess
+many_write(RegisterArea *a, const RegisterAtom *src,
+           RegisterOffset offset, RegisterOffset n)
+{
+    RegisterAccess rv = REG_ACCESS_RESULT_INIT;
+    (void)a;
+    many_writes++;
+    memcpy(many_backing + offset, src, n * sizeof(RegisterAtom));
+    return rv;
+}
+
+static void
+t_many_access(void)
+{
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            MEMORY_AREA(0x0000ul, 0x10ul),
+            MEMORY_AREA_RO(0x0010ul, 0x10ul),
+            CUSTOM_AREA(many_read, many_write, 0x0100ul, 0x20ul),
+            CUSTOM_AREA_RO(many_read, 0x0200ul, 0x10ul),
+            REGISTER_AREA_END
+        },
+        .entry = (RegisterEntry[]) {
+            REG_U16(0, 0x0000ul, 1u),
+            REG_U32(1, 0x0002ul, 2ul),
+            REG_U16(2, 0x0010ul, 3u),
+            REG_U16(3, 0x0100ul, 4u),
+            REG_U32(4, 0x0101ul, 5ul),
+            REG_F32(5, 0x0103ul, 6.F),
+            REG_U16(6, 0x0110ul, 7u),
+            REG_U16(7, 0x0200ul, 8u),
+            REGISTER_ENTRY_END
+        },
+        .dirty = REGISTER_DIRTY_MAP(8u)
+    };
+
+    RegisterInit success = register_init(&t);
+    cmp_code(success.code, ==, REG_INIT_SUCCESS, "many: t initialises");
+
+    const RegisterHandle all[] = { 2u, 0u, 1u, 3u, 4u, 5u, 6u };
+    RegisterValue v[7];
+    many_reads = 0u;
+    RegisterAccess rv = register_get_many(&t, all, 7u, v);
+    ok(rv.code == REG_ACCESS_SUCCESS
+       && v[0].value.u16 == 3u && v[1].value.u16 == 1u
+       && v[2].value.u32 == 2ul && v[3].value.u16 == 4u
+       && v[4].value.u32 == 5ul && v[5].value.f32 == 6.F
+       && v[6].value.u16 == 7u,
+       "many: get_many() reads all values");
+    cmp_code(many_reads, ==, 2u,
+             "many: adjacent entries in custom areas are read in one go");
+
+    const RegisterHandle rw[] = { 0u, 3u, 4u, 5u };
+    const RegisterValue nv[] = {
+        RV(UINT16, u16, 10u), RV(UINT16, u16, 40u),
+        RV(UINT32, u32, 50ul), RV(FLOAT32, f32, 60.F)
+    };
+    many_writes = 0u;
+    rv = register_set_many(&t, rw, 4u, nv);
+    ok(rv.code == REG_ACCESS_SUCCESS && many_writes == 1u,
+       "many: set_many() writes adjacent entries in one go");
+    bool good = true;
+    for (size_t i = 0u; i < 4u; ++i) {
+        RegisterValue r;
+        register_get(&t, rw[i], &r);
+        good = good && memcmp(&r.value, &nv[i].value, sizeof(r.value)) == 0;
+    }
+    ok(good && register_is_dirty(&t, 0u) && register_is_dirty(&t, 5u)
+       && register_is_dirty(&t, 1u) == false,
+       "many: set_many() stores values and marks them dirty");
+
+    const RegisterValue bad[] = {
+        RV(UINT16, u16, 11u), RV(UINT16, u16, 41u),
+        RV(UINT32, u32, 51ul), RV(FLOAT32, f32, NAN)
+    };
+    rv = register_set_many(&t, rw, 4u, bad);
+    RegisterValue r;
+    register_get(&t, 0u, &r);
+    ok(rv.code == REG_ACCESS_INVALID && rv.address == 0x0103ul
+       && r.value.u16 == 10u,
+       "many: set_many() rejects batches before writing anything");
+
+    const RegisterHandle ro[] = { 0u, 7u };
+    rv = register_set_many(&t, ro, 2u, nv);
+    ok(rv.code == REG_ACCESS_READONLY && rv.address == 0x0200ul,
+       "many: set_many() refuses read-only areas");
+
+    const RegisterHandle missing[] = { 0u, 8u };
+    rv = register_get_many(&t, missing, 2u, v);
+    ok(rv.code == REG_ACCESS_NOENTRY && rv.address == 8u,
+       "many: get_many() refuses unknown handles");
+}
+
+static void
+t_fast_access(void)
+{
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            MEMORY_AREA(0x0000ul, 0x40ul),
+            CUSTOM_AREA(many_read, many_write, 0x0100ul, 0x20ul),
+            REGISTER_AREA_END
+        },
+        .entry = (RegisterEntry[]) {
+            REG_U16(0, 0x0000ul, 0x1234u),
+            REG_U32(1, 0x0002ul, 0x12345678ul),
+            REG_U64(2, 0x0004ul, 0x1234567890abcdefull),
+            REG_S16(3, 0x0008ul, -2),
+            REG_S32(4, 0x000aul, -3l),
+            REG_S64(5, 0x000cul, -4ll),
+            REG_F32(6, 0x0010ul, 1.5F),
+            REG_F64(7, 0x0012ul, -2.5),
+            REG_U16RANGE(8, 0x0016ul, 10u, 20u, 15u),
+            REG_U32(9, 0x0100ul, 0xcafe0000ul),
+            REGISTER_ENTRY_END
+        },
+        .dirty = REGISTER_DIRTY_MAP(10u)
+    };
+
+    RegisterInit success = register_init(&t);
+    cmp_code(success.code, ==, REG_INIT_SUCCESS, "fast: t initialises");
+
+    ok(register_get_u16_fast(&t, 0u) == 0x1234u
+       && register_get_u32_fast(&t, 1u) == 0x12345678ul
+       && register_get_u64_fast(&t, 2u) == 0x1234567890abcdefull
+       && register_get_s16_fast(&t, 3u) == -2
+       && register_get_s32_fast(&t, 4u) == -3l
+       && register_get_s64_fast(&t, 5u) == -4ll
+       && register_get_f32_fast(&t, 6u) == 1.5F
+       && register_get_f64_fast(&t, 7u) == -2.5,
+       "fast: getters read default values");
+
+    register_set_u16_fast(&t, 0u, 0x4321u);
+    register_set_u32_fast(&t, 1u, 0x87654321ul);
+    register_set_u64_fast(&t, 2u, 0xfedcba0987654321ull);
+    register_set_s16_fast(&t, 3u, 2);
+    register_set_s32_fast(&t, 4u, 3l);
+    register_set_s64_fast(&t, 5u, 4ll);
+    register_set_f32_fast(&t, 6u, -1.5F);
+    register_set_f64_fast(&t, 7u, 2.5);
+    RegisterValue v[8];
+    const RegisterHandle h[] = { 0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u };
+    register_get_many(&t, h, 8u, v);
+    ok(v[0].value.u16 == 0x4321u && v[1].value.u32 == 0x87654321ul
+       && v[2].value.u64 == 0xfedcba0987654321ull && v[3].value.s16 == 2
+       && v[4].value.s32 == 3l && v[5].value.s64 == 4ll
+       && v[6].value.f32 == -1.5F && v[7].value.f64 == 2.5,
+       "fast: setters store values like register_set()");
+    ok(register_is_dirty(&t, 0u) && register_is_dirty(&t, 7u)
+       && register_is_dirty(&t, 8u) == false,
+       "fast: setters mark entries dirty");
+
+    RegisterAccess rv = register_set_u16_fast(&t, 8u, 30u);
+    ok(rv.code == REG_ACCESS_RANGE && register_get_u16_fast(&t, 8u) == 15u,
+       "fast: validators are honoured");
+    rv = register_set_u32_fast(&t, 0u, 1ul);
+    ok(rv.code == REG_ACCESS_RANGE && register_get_u32_fast(&t, 0u) == 0ul,
+       "fast: type mismatches fall back to the generic path");
+    rv = register_set_f32_fast(&t, 6u, NAN);
+    ok(rv.code == REG_ACCESS_INVALID && register_get_f32_fast(&t, 6u) == -1.5F,
+       "fast: abnormal floats are rejected");
+
+    many_reads = 0u;
+    many_writes = 0u;
+    rv = register_set_u32_fast(&t, 9u, 0xbeefuL);
+    ok(rv.code == REG_ACCESS_SUCCESS
+       && register_get_u32_fast(&t, 9u) == 0xbeefuL
+       && many_reads == 1u && many_writes == 1u,
+       "fast: custom areas use their callbacks");
+
+    /* A NaN in memory is rejected by register_get(); the fast getter must
+     * agree with that. */
+    bf_set_u32l(t.area[0].mem + 0x10u, 0x7fc00000ul);
+    RegisterValue nan;
+    rv = register_get(&t, 6u, &nan);
+    ok(rv.code == REG_ACCESS_INVALID && register_get_f32_fast(&t, 6u) == 0.F,
+       "fast: abnormal floats in memory read like with register_get()");
+    register_set_f32_fast(&t, 6u, -1.5F);
+
+    register_make_bigendian(&t, true);
+    register_set_u32_fast(&t, 1u, 0x11223344ul);
+    const unsigned char be[] = { 0x11u, 0x22u, 0x33u, 0x44u };
+    ok(memcmp(t.area[0].mem + 2u, be, sizeof(be)) == 0
+       && register_get_u32_fast(&t, 1u) == 0x11223344ul,
+       "fast: big-endian tables are honoured");
+}
+
+static void
+t_seqlock(void)
+{
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+    const bool seqlock = true;
+#else
+    const bool seqlock = false;
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            MEMORY_AREA(0x0000ul, 0x10ul),
+            MEMORY_AREA(0x0010ul, 0x10ul),
+            REGISTER_AREA_END
+        },
+        .entry = (RegisterEntry[]) {
+            REG_U32(0, 0x0000ul, 1ul),
+            REG_U32(1, 0x0002ul, 2ul),
+            REG_U32(2, 0x0010ul, 3ul),
+            REGISTER_ENTRY_END
+        }
+    };
+
+    RegisterInit success = register_init(&t);
+    cmp_code(success.code, ==, REG_INIT_SUCCESS, "seqlock: t initialises");
+
+    RegisterArea *a = &t.area[0];
+    RegisterSequence s = register_area_read_begin(a);
+    RegisterValue v[2];
+    const RegisterHandle h[] = { 0u, 1u };
+    register_get_many(&t, h, 2u, v);
+    (void)register_get_u32_fast(&t, 0u);
+    ok(register_area_read_retry(a, s) == false,
+       "seqlock: reads do not disturb readers");
+
+    register_set_u32_fast(&t, 2u, 4ul);
+    ok(register_area_read_retry(a, s) == false,
+       "seqlock: writes to other areas do not disturb readers");
+
+    register_set(&t, 1u, RV(UINT32, u32, 5ul));
+    ok(register_area_read_retry(a, s) == seqlock,
+       "seqlock: writes make readers retry, if enabled");
+}
+
+static unsigned int crit_enter = 0u;
+static unsigned int crit_leave = 0u;
+static uint32_t crit_state = 0u;
+
+/* The hooks must not run within the write section of crit_area: A reader in
+ * an interrupt handler would spin on its odd sequence counter forever. */
+static RegisterArea *crit_area = NULL;
+static bool crit_in_write = false;
+
+static void
+t_check_write_section(void)
+{
+#ifdef REGISTER_TABLE_WITH_SEQLOCK
+    if (crit_area != NULL && (atomic_load(&crit_area->seq) & 1u) != 0u) {
+        crit_in_write = true;
+    }
+#endif /* REGISTER_TABLE_WITH_SEQLOCK */
+}
+
+static uint32_t
+t_enter_critical(void)
+{
+    t_check_write_section();
+    crit_enter++;
+    return 0x5a5au + crit_enter;
+}
+
+static void
+t_leave_critical(uint32_t state)
+{
+    t_check_write_section();
+    crit_leave++;
+    crit_state = state;
+}
+
+static void
+t_rmw(void)
+{
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            MEMORY_AREA(0x0000ul, 0x10ul),
+            CUSTOM_AREA(many_read, many_write, 0x0100ul, 0x20ul),
+            REGISTER_AREA_END
+        },
+        .entry = (RegisterEntry[]) {
+            REG_U16(0, 0x0000ul, 0x0001u),
+            REG_U16MAX(1, 0x0001ul, 0x00ffu, 0x0010u),
+            REG_F32(2, 0x0002ul, 1.F),
+            REG_U32(3, 0x0100ul, 7ul),
+            REGISTER_ENTRY_END
+        },
+        .dirty = REGISTER_DIRTY_MAP(4u),
+        .critical = { .enter = t_enter_critical, .leave = t_leave_critical }
+    };
+
+    RegisterInit success = register_init(&t);
+    cmp_code(success.code, ==, REG_INIT_SUCCESS, "rmw: t initialises");
+
+    crit_enter = crit_leave = 0u;
+    RegisterAccess rv = register_bit_set(&t, 0u, RV(UINT16, u16, 0x0100u));
+    ok(rv.code == REG_ACCESS_SUCCESS
+       && register_get_u16_fast(&t, 0u) == 0x0101u
+       && register_is_dirty(&t, 0u),
+       "rmw: bit_set() modifies and marks the register");
+
+    rv = register_bit_set(&t, 1u, RV(UINT16, u16, 0x0100u));
+    ok(rv.code == REG_ACCESS_RANGE && register_get_u16_fast(&t, 1u) == 0x0010u,
+       "rmw: results of bit operations are validated");
+
+    RegisterValue expected = RV(FLOAT32, f32, 1.F);
+    rv = register_cas(&t, 2u, &expected, RV(FLOAT32, f32, 2.F));
+    ok(rv.code == REG_ACCESS_SUCCESS && register_get_f32_fast(&t, 2u) == 2.F,
+       "rmw: cas() swaps, if the expected value matches");
+
+    rv = register_cas(&t, 2u, &expected, RV(FLOAT32, f32, 3.F));
+    ok(rv.code == REG_ACCESS_MISMATCH && expected.value.f32 == 2.F
+       && register_get_f32_fast(&t, 2u) == 2.F,
+       "rmw: cas() reports the current value on mismatch");
+
+    rv = register_cas(&t, 2u, &expected, RV(UINT16, u16, 3u));
+    ok(rv.code == REG_ACCESS_INVALID, "rmw: cas() rejects type mismatches");
+
+    ok(crit_enter == 4u && crit_leave == 4u && crit_state == 0x5a5au + 4u,
+       "rmw: critical section hooks wrap every operation");
+
+    crit_area = &t.area[0];
+    rv = register_bit_clear(&t, 0u, RV(UINT16, u16, 0x0100u));
+    crit_area = NULL;
+    ok(rv.code == REG_ACCESS_SUCCESS && crit_in_write == false
+       && register_get_u16_fast(&t, 0u) == 0x0001u,
+       "rmw: critical sections enclose the write section");
+
+    many_reads = many_writes = 0u;
+    expected = RV(UINT32, u32, 7ul);
+    rv = register_cas(&t, 3u, &expected, RV(UINT32, u32, 8ul));
+    ok(rv.code == REG_ACCESS_SUCCESS && many_reads == 1u && many_writes == 1u
+       && register_get_u32_fast(&t, 3u) == 8ul,
+       "rmw: custom areas are accessed through their callbacks");
+}
+
+static void
+t_db_observer(RegisterTable *t, RegisterHandle first,
+              UNUSED RegisterHandle last, void *arg)
+{
+    uint16_t *seen = arg;
+    *seen = register_get_u16_fast(t, first);
+}
+
+static void
+t_double_buffer(void)
+{
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            DOUBLE_BUFFERED_AREA(0x0000ul, 0x10ul),
+            MEMORY_AREA(0x0010ul, 0x10ul),
+            REGISTER_AREA_END
+        },
+        .entry = (RegisterEntry[]) {
+            REG_U16(0, 0x0000ul, 1u),
+            REG_U32RANGE(1, 0x0001ul, 0ul, 0x18000ul, 2ul),
+            REG_U16(2, 0x0003ul, 3u),
+            REG_U16(3, 0x0010ul, 4u),
+            REG_U32(4, 0x0011ul, 5ul),
+            REG_U16(5, 0x0013ul, 6u),
+            REGISTER_ENTRY_END
+        },
+        .dirty = REGISTER_DIRTY_MAP(6u),
+        .observers = REGISTER_OBSERVERS(1u, 1u)
+    };
+
+    RegisterInit success = register_init(&t);
+    ok(success.code == REG_INIT_SUCCESS
+       && register_get_u16_fast(&t, 0u) == 1u
+       && register_get_u16_fast(&t, 2u) == 3u,
+       "double-buffer: defaults are published by init");
+
+    register_set_u16_fast(&t, 0u, 10u);
+    register_set(&t, 1u, RV(UINT32, u32, 20ul));
+    register_bit_set(&t, 2u, RV(UINT16, u16, 0x0100u));
+    ok(register_get_u16_fast(&t, 0u) == 1u
+       && register_get_u32_fast(&t, 1u) == 2ul
+       && register_get_u16_fast(&t, 2u) == 3u,
+       "double-buffer: writes are staged");
+
+    RegisterAccess rv = register_area_publish(&t, 0u);
+    ok(rv.code == REG_ACCESS_SUCCESS
+       && register_get_u16_fast(&t, 0u) == 10u
+       && register_get_u32_fast(&t, 1u) == 20ul
+       && register_get_u16_fast(&t, 2u) == 0x0103u,
+       "double-buffer: publishing makes staged writes visible");
+
+    register_set_u16_fast(&t, 2u, 30u);
+    register_area_publish(&t, 0u);
+    ok(register_get_u16_fast(&t, 0u) == 10u
+       && register_get_u16_fast(&t, 2u) == 30u,
+       "double-buffer: staging starts from the published state");
+
+    /* Changes are marked and announced once readers can see them. */
+    RegisterDirtyWord snapshot[REGISTER_DIRTY_WORDS(6u)];
+    uint16_t seen = 0u;
+    register_observe(&t, 0u, 0u, t_db_observer, &seen, REG_NOTIFY_IMMEDIATE);
+    (void)register_dirty_snapshot(&t, snapshot, 1u);
+    register_set(&t, 0u, RV(UINT16, u16, 42u));
+    (void)register_dirty_snapshot(&t, snapshot, 1u);
+    ok(snapshot[0] == 0u && seen == 0u,
+       "double-buffer: staged writes are not reported");
+    register_area_publish(&t, 0u);
+    ok(register_is_dirty(&t, 0u) && register_is_dirty(&t, 2u) == false
+       && seen == 42u,
+       "double-buffer: publishing marks and notifies changes");
+
+    /* Fast reads follow the area's memory, when publishing swaps it. */
+    const uint16_t before = register_get_u16_fast(&t, 2u);
+    register_set_u16_fast(&t, 2u, 33u);
+    const uint16_t staged = register_get_u16_fast(&t, 2u);
+    register_area_publish(&t, 0u);
+    ok(before == 30u && staged == 30u && register_get_u16_fast(&t, 2u) == 33u,
+       "double-buffer: fast reads see what was published in between");
+    register_set_u16_fast(&t, 2u, 30u);
+    register_area_publish(&t, 0u);
+
+    const RegisterAtom *published = t.area[0].mem;
+    register_area_publish(&t, 0u);
+    ok(t.area[0].mem == published && register_get_u16_fast(&t, 2u) == 30u,
+       "double-buffer: publishing without staged writes does nothing");
+
+    rv = register_area_publish(&t, 1u);
+    ok(rv.code == REG_ACCESS_INVALID, "double-buffer: plain areas are refused");
+
+    (void)register_dirty_snapshot(&t, snapshot, 1u);
+    rv = register_mcopy(&t, 0u, 1u);
+    ok(rv.code == REG_ACCESS_SUCCESS
+       && register_get_u16_fast(&t, 0u) == 4u
+       && register_get_u32_fast(&t, 1u) == 5ul
+       && register_get_u16_fast(&t, 2u) == 6u,
+       "double-buffer: mcopy() publishes the copy");
+    ok(register_is_dirty(&t, 0u) && register_is_dirty(&t, 2u)
+       && register_is_dirty(&t, 3u) == false && seen == 4u,
+       "double-buffer: mcopy() reports what it published");
+    rv = register_mcopy(&t, 1u, 0u);
+    ok(rv.code == REG_ACCESS_SUCCESS
+       && register_is_dirty(&t, 3u) && register_is_dirty(&t, 5u),
+       "double-buffer: mcopy() marks plain destination areas");
+
+    /* A block that covers only the low half of the staged 0x10000 would make
+     * it 0x19000, which is out of range. Merging against the published 5
+     * would miss that. */
+    RegisterAtom low = 0x9000u;
+    register_set(&t, 1u, RV(UINT32, u32, 0x10000ul));
+    rv = register_block_write(&t, 0x0001ul, 1u, &low);
+    register_area_publish(&t, 0u);
+    ok(rv.code == REG_ACCESS_RANGE && rv.address == 0x0001ul
+       && register_get_u32_fast(&t, 1u) == 0x10000ul,
+       "double-buffer: partial block writes merge with staged memory");
+
+    t.area[0].shadow = NULL;
+    success = register_init(&t);
+    ok(success.code == REG_INIT_AREA_NO_SHADOW && success.pos.area == 0u,
+       "double-buffer: init requires a shadow copy");
+}
+
+static void
+t_block_write_validation(void)
+{
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            MEMORY_AREA(0x0000ul, 0x10ul),
+            MEMORY_AREA(0x0010ul, 0x10ul),
+            MEMORY_AREA(0x0030ul, 0x10ul),
+            REGISTER_AREA_END
+        },
+        .entry = (RegisterEntry[]) {
+            REG_U16RANGE(0, 0x000ful, 0u, 100u, 1u),
+            REG_U32(     1, 0x0010ul, 2ul),
+            REG_U16RANGE(2, 0x0012ul, 0u, 100u, 3u),
+            REG_U16(     3, 0x0030ul, 4u),
+            REGISTER_ENTRY_END
+        },
+        .dirty = REGISTER_DIRTY_MAP(4u)
+    };
+
+    RegisterInit success = register_init(&t);
+    if (success.code != REG_INIT_SUCCESS) {
+        ok(false, "block-write: table initialises");
+        return;
+    }
+
+    /* The block spans two areas; the entry in the second one is out of
+     * range. Nothing may be written. */
+    RegisterAtom buf[0x20] = { 7u, 0x1111u, 0x2222u, 200u };
+    RegisterAccess a = register_block_write(&t, 0x000ful, 4u, buf);
+    ok(a.code == REG_ACCESS_RANGE && a.address == 0x0012ul
+       && register_get_u16_fast(&t, 0u) == 1u
+       && register_get_u32_fast(&t, 1u) == 2ul
+       && register_is_dirty(&t, 0u) == false,
+       "block-write: invalid entry in later area rejects the whole block");
+
+    /* Holes take precedence over malformed entries. */
+    buf[0] = 200u;
+    a = register_block_write(&t, 0x0012ul, 0x20u, buf);
+    ok(a.code == REG_ACCESS_NOENTRY && a.address == 0x0020ul,
+       "block-write: holes are reported before invalid entries");
+
+    buf[0] = 7u;
+    buf[3] = 9u;
+    a = register_block_write(&t, 0x000ful, 4u, buf);
+    ok(a.code == REG_ACCESS_SUCCESS
+       && register_get_u16_fast(&t, 0u) == 7u
+       && register_get_u32_fast(&t, 1u) == 0x22221111ul
+       && register_get_u16_fast(&t, 2u) == 9u
+       && register_is_dirty(&t, 0u) && register_is_dirty(&t, 1u)
+       && register_is_dirty(&t, 2u) && register_is_dirty(&t, 3u) == false,
+       "block-write: valid block across areas commits and marks entries");
+
+    /* Only touching the upper half of an entry keeps the lower half. */
+    buf[0] = 0xaaaau;
+    buf[1] = 50u;
+    a = register_block_write(&t, 0x0011ul, 2u, buf);
+    ok(a.code == REG_ACCESS_SUCCESS
+       && register_get_u32_fast(&t, 1u) == 0xaaaa1111ul
+       && register_get_u16_fast(&t, 2u) == 50u,
+       "block-write: partially covered entries are merged");
+}
+
+struct t_note {
+    size_t calls;
+    RegisterHandle first;
+    RegisterHandle last;
+};
+
+static void
+t_observer(RegisterTable *t, RegisterHandle first, RegisterHandle last,
+           void *arg)
+{
+    struct t_note *note = arg;
+    (void)t;
+    note->calls++;
+    note->first = first;
+    note->last = last;
+}
+
+static void
+t_observers(void)
+{
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            MEMORY_AREA(0x0000ul, 0x10ul),
+            MEMORY_AREA(0x0010ul, 0x10ul),
+            REGISTER_AREA_END
+        },
+        .entry = (RegisterEntry[]) {
+            REG_U16(0, 0x0000ul, 1u),
+            REG_U32(1, 0x0001ul, 2ul),
+            REG_U16(2, 0x000ful, 3u),
+            REG_U16(3, 0x0010ul, 4u),
+            REG_U16(4, 0x0011ul, 5u),
+            REG_U16(5, 0x0012ul, 6u),
+            REGISTER_ENTRY_END
+        },
+        .observers = REGISTER_OBSERVERS(3u, 2u),
+        .critical = { .enter = t_enter_critical, .leave = t_leave_critical }
+    };
+    struct t_note low = { 0 }, high = { 0 }, later = { 0 };
+
+    RegisterInit success = register_init(&t);
+    RegisterAccess a = register_observe(&t, 0u, 2u, t_observer, &low,
+                                        REG_NOTIFY_IMMEDIATE);
+    RegisterAccess b = register_observe(&t, 2u, 5u, t_observer, &high,
+                                        REG_NOTIFY_IMMEDIATE);
+    RegisterAccess c = register_observe(&t, 4u, 6u, t_observer, &later,
+                                        REG_NOTIFY_DEFERRED);
+    ok(success.code == REG_INIT_SUCCESS
+       && a.code == REG_ACCESS_SUCCESS && b.code == REG_ACCESS_SUCCESS
+       && c.code == REG_ACCESS_NOENTRY && low.calls == 0u,
+       "observers: registration checks handles, init does not notify");
+
+    register_set(&t, 1u, RV(UINT32, u32, 20ul));
+    ok(low.calls == 1u && low.first == 1u && low.last == 1u
+       && high.calls == 0u,
+       "observers: register_set() notifies observers of that register");
+
+    /* 0x0000 to 0x0011 changes registers 0 to 4 in two areas. */
+    RegisterAtom buf[0x12] = { 0 };
+    register_block_write(&t, 0x0000ul, 0x12u, buf);
+    ok(low.calls == 2u && low.first == 0u && low.last == 2u
+       && high.calls == 1u && high.first == 2u && high.last == 4u,
+       "observers: block write notifies once per observer");
+
+    /* The queue is shared between writer and drain, that need the hooks. */
+    const RegisterCritical critical = t.critical;
+    t.critical.leave = NULL;
+    c = register_observe(&t, 3u, 5u, t_observer, &later,
+                         REG_NOTIFY_DEFERRED);
+    t.critical = critical;
+    ok(c.code == REG_ACCESS_INVALID && t.observers.count == 2u,
+       "observers: deferred observers require critical section hooks");
+
+    c = register_observe(&t, 3u, 5u, t_observer, &later,
+                         REG_NOTIFY_DEFERRED);
+    register_set_u16_fast(&t, 3u, 30u);
+    register_set_u16_fast(&t, 4u, 40u);
+    register_set_u16_fast(&t, 3u, 31u);
+    ok(c.code == REG_ACCESS_SUCCESS && later.calls == 0u
+       && register_notify_pending(&t) == 1u
+       && register_get_u16_fast(&t, 3u) == 31u,
+       "observers: deferred notifications are queued and coalesced");
+
+    const RegisterHandle h[] = { 5u, 0u };
+    const RegisterValue v[] = { RV(UINT16, u16, 50u), RV(UINT16, u16, 0u) };
+    register_set_many(&t, h, 2u, v);
+    const size_t done = register_notify_drain(&t, 8u);
+    ok(done == 1u && later.calls == 1u
+       && later.first == 3u && later.last == 5u
+       && register_notify_pending(&t) == 0u,
+       "observers: draining delivers queued notifications");
+
+    register_set(&t, 3u, RV(UINT16, u16, 1u));
+    register_set(&t, 5u, RV(UINT16, u16, 1u));
+    register_set(&t, 3u, RV(UINT16, u16, 2u));
+    ok(register_notify_pending(&t) == 2u && t.observers.queue.lost == 1u
+       && register_notify_drain(&t, 1u) == 1u
+       && later.first == 3u && later.last == 3u
+       && register_notify_pending(&t) == 1u,
+       "observers: full queue counts lost notifications");
+
+    /* Writes that bypass the entries notify the entries they overlap. */
+    const size_t lc = low.calls, hc = high.calls;
+    register_set_from_hexstr(&t, 0x000ful, "00010002", 8u);
+    ok(low.calls == lc + 1u && low.first == 2u && low.last == 2u
+       && high.calls == hc + 1u && high.first == 2u && high.last == 3u,
+       "observers: hexstr writes notify once per observer");
+
+    register_mcopy(&t, 1u, 0u);
+    ok(low.calls == lc + 1u && high.calls == hc + 2u
+       && high.first == 3u && high.last == 5u,
+       "observers: mcopy() notifies observers of its destination");
+}
+
+static void
+t_entry_index(void)
+{
+    RegisterTable t = {
+        .area = (RegisterArea[]) {
+            MEMORY_AREA(0x0000ul, 0x08ul),
+            MEMORY_AREA(0x0100ul, 0x08ul),
+            REGISTER_AREA_END
+        },
+        .entry = (RegisterEntry[]) {
+            REG_U16(0, 0x0000ul, 0u),
+            REG_U32(1, 0x0002ul, 0x11111111ul),
+            REG_U16(2, 0x0005ul, 0x2222u),
+            REG_U64(3, 0x0100ul, 0x3333333333333333ull),
+            REG_U16(4, 0x0107ul, 0x4444u),
+            REGISTER_ENTRY_END
+        },
+        .index = REGISTER_INDEX(5u)
+    };
+
+    RegisterInit success = register_init(&t);
+    ok(success.code == REG_INIT_SUCCESS
+       && t.index.address[3] == 0x0100ul
+       && t.index.type[3] == REG_TYPE_UINT64
+       && t.area[1].entry.first == 3u && t.area[1].entry.count == 2u,
+       "index: init fills the index and links areas through it");
+
+    RegisterAtom buf[4] = { 0xaaaau, 0xbbbbu, 0xccccu, 0xddddu };
+    RegisterAccess acc = register_block_write(&t, 0x0003ul, 3u, buf);
+    RegisterValue v1, v2;
+    register_get(&t, 1u, &v1);
+    register_get(&t, 2u, &v2);
+    ok(acc.code == REG_ACCESS_SUCCESS && v1.value.u32 == 0xaaaa1111ul
+       && v2.value.u16 == 0xccccu,
+       "index: block writes find their entries through the index");
+
+    unsigned int count = 0u;
+    acc = register_foreach_in(&t, 0x0003ul, 0x0101ul, f_cb_count, &count);
+    ok(acc.code == REG_ACCESS_SUCCESS && count == 3u,
+       "index: iteration finds its entries through the index");
+
+    t.index.size = 4u;
+    success = register_init(&t);
+    ok(success.code == REG_INIT_INDEX_TOO_SMALL,
+       "index: init rejects an index that is too small");
+}
+
 struct t_ep0 {
     unsigned int a;
     unsigned int b;
@@ -1160,7 +2077,7 @@ t_bit_operations(void)
 int
 main(UNUSED int argc, UNUSED char *argv[])
 {
-    plan(3+1+1+4+16+54+(7*18)+15+26+3+3+2+11+6+5+4+27);
+    plan(3+1+1+4+16+54+(7*18)+15+26+4+3+2+11+6+10+6+8+8+10+4+9+14+4+9+4+5+4+27);
     t_invalid_tables();    /*  3 */
     t_trivial_success();   /*  1 */
     t_trivial_fail();      /*  1 */
@@ -1176,11 +2093,22 @@ main(UNUSED int argc, UNUSED char *argv[])
     t_f32_regs();          /* 18 */
     t_f32_abnormal();      /* 15 */
     t_block_access();      /* 26 */
-    t_hexstring();         /*  3 */
+    t_hexstring();         /*  4 */
     t_sanitise();          /*  3 */
     t_iterate_empty();     /*  2 */
     t_iterate_single();    /* 11 */
     t_iterate_miss();      /*  6 */
+    t_many_areas();        /* 10 */
+    t_default_image();     /*  6 */
+    t_dirty_tracking();    /*  8 */
+    t_many_access();       /*  8 */
+    t_fast_access();       /* 10 */
+    t_seqlock();           /*  4 */
+    t_rmw();               /*  9 */
+    t_double_buffer();     /* 14 */
+    t_block_write_validation(); /*  4 */
+    t_observers();         /*  9 */
+    t_entry_index();       /*  4 */
     t_reg_entry_pointer(); /*  5 */
     t_big_endian();        /*  4 */
     t_bit_operations();    /* 27 */
@@ -112,6 +112,64 @@ static char *sync_without_sof[] = {
     "", "abc", "", "def", "ghi", "", "jkl", "", "mno"
 };
 
+/*
+ * Collector for frames delivered by rfc1055_decode_feed()
+ */
+
+#define MAX_FRAMES 16u
+#define MAX_FRAME_SIZE 64u
+
+typedef struct FeedResult {
+    size_t frames;
+    int status[MAX_FRAMES];
+    size_t size[MAX_FRAMES];
+    unsigned char data[MAX_FRAMES][MAX_FRAME_SIZE];
+} FeedResult;
+
+static int
+collect_frame(void *arg, ByteBuffer *frame, int status)
+{
+    FeedResult *r = arg;
+    if (r->frames >= MAX_FRAMES) {
+        return -ENOMEM;
+    }
+    const size_t n = MIN(frame->used, MAX_FRAME_SIZE);
+    r->status[r->frames] = status;
+    r->size[r->frames] = frame->used;
+    memcpy(r->data[r->frames], frame->data, n);
+    r->frames++;
+    return 0;
+}
+
+/* Compare collected frames to a list of expected strings. A NULL pointer in
+ * the list means, that a frame with an error status is expected. */
+static bool
+feed_matches(const FeedResult *r, char **expect, const size_t n)
+{
+    if (r->frames != n) {
+        printf("# frames: %zu, expected: %zu\n", r->frames, n);
+        return false;
+    }
+    for (size_t i = 0u; i < n; ++i) {
+        if (expect[i] == NULL) {
+            if (r->status[i] >= 0) {
+                printf("# frame %zu: expected an error\n", i);
+                return false;
+            }
+            continue;
+        }
+        const size_t l = strlen(expect[i]);
+        if (r->status[i] != 0 || r->size[i] != l
+            || memcmp(r->data[i], expect[i], l) != 0)
+        {
+            printf("# frame %zu: status %d, size %zu\n",
+                   i, r->status[i], r->size[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
 int
 main(UNUSED int argc, UNUSED char **argv)
 {
@@ -124,7 +182,7 @@ main(UNUSED int argc, UNUSED char **argv)
     const size_t swos_n = sizeof(sync_without_sof)/sizeof(*sync_without_sof);
     const size_t sws_n = sizeof(sync_with_sof)/sizeof(*sync_with_sof);
 
-    plan(23 + (swos_n + (sws_n - 1)) * 3 + 1);
+    plan(42 + (swos_n + (sws_n - 1)) * 3 + 1);
 
     /*
      * General encoding tests
@@ -194,6 +252,71 @@ main(UNUSED int argc, UNUSED char **argv)
     ok(rc == -EIO, "RFC1055 encoder passes error code correctly, %d", rc);
     instrumentable_reset_error(&sink_buffer.write.error);
 
+    /*
+     * Bulk encoding tests
+     *
+     * Encoding from memory, and from sources that allow reading more than one
+     * octet at a time, scans for runs of octets that need no escaping. These
+     * must yield the same results as the octet by octet encoder.
+     */
+
+    byte_buffer_clear(&sink_buffer.buffer);
+    rc = rfc1055_encode_buffer(&rfc1055_with_sof, payload, sizeof(payload),
+                               &sink);
+    ok(rc == 0 && sink_buffer.buffer.used == sizeof(expect_with_sof),
+       "RFC1055 bulk encode yields correct length (%zu)",
+       sink_buffer.buffer.used);
+    cmp_mem(expect_with_sof, sink_buffer.buffer.data,
+            MIN(sizeof(expect_with_sof), sink_buffer.buffer.used),
+            "RFC1055 bulk encode(...) works");
+
+    {
+        Source csource;
+        instrumentable_source(DATA_KIND_CHUNK, &csource, &source_buffer);
+        instrumentable_chunksize(&source_buffer, 7u);
+        byte_buffer_add(&source_buffer.buffer, payload, sizeof(payload));
+        byte_buffer_clear(&sink_buffer.buffer);
+        rc = rfc1055_encode(&rfc1055_classic, &csource, &sink);
+        ok(rc == 0 && sink_buffer.buffer.used == sizeof(expect_with_sof) - 1,
+           "RFC1055 chunk source encode yields correct length (%zu)",
+           sink_buffer.buffer.used);
+        cmp_mem(expect_with_sof + 1, sink_buffer.buffer.data,
+                MIN(sizeof(expect_with_sof) - 1, sink_buffer.buffer.used),
+                "RFC1055 chunk source encode(...) works");
+    }
+
+    {
+        /* Put a single control character at every possible position of a
+         * buffer, that is longer than any of the scanner's step sizes. */
+        static unsigned char plain[70];
+        const unsigned char special[] = { RAW_EOF, RAW_ESC };
+        size_t failures = 0u;
+        for (size_t s = 0u; s < sizeof(special); ++s) {
+            for (size_t pos = 0u; pos < sizeof(plain); ++pos) {
+                memset(plain, 'x', sizeof(plain));
+                plain[pos] = special[s];
+                byte_buffer_clear(&sink_buffer.buffer);
+                rc = rfc1055_encode_buffer(&rfc1055_classic, plain,
+                                           sizeof(plain), &sink);
+                const unsigned char *d = sink_buffer.buffer.data;
+                const unsigned char e = s == 0u ? ESC_EOF : ESC_ESC;
+                bool good = (rc == 0 && sink_buffer.buffer.used == 72u
+                             && d[pos] == RAW_ESC && d[pos + 1u] == e
+                             && d[71] == RAW_EOF);
+                for (size_t i = 0u; good && i < 71u; ++i) {
+                    if (i != pos && i != pos + 1u && d[i] != 'x') {
+                        good = false;
+                    }
+                }
+                if (good == false) {
+                    printf("# failed with 0x%02x at %zu\n", special[s], pos);
+                    failures++;
+                }
+            }
+        }
+        ok(failures == 0u, "RFC1055 bulk encode finds all control characters");
+    }
+
     /*
      * General decoding tests
      */
@@ -387,6 +510,142 @@ main(UNUSED int argc, UNUSED char **argv)
     cmp_mem(sink_buffer.buffer.data, "foo", 3,
             "RFC1055 Frame after error has correct contents");
 
+    /*
+     * Resumable decoder tests
+     */
+
+    {
+        static unsigned char fbuf[MAX_FRAME_SIZE];
+        ByteBuffer frame = BYTE_BUFFER_EMPTY(fbuf, sizeof(fbuf));
+        FeedResult r;
+        ssize_t frc = 0;
+
+        /* Feeding one octet at a time splits every escape sequence. */
+        memset(&r, 0, sizeof(r));
+        rfc1055_context_init(&rfc1055_with_sof, RFC1055_WITH_SOF);
+        for (size_t i = 0u; i < sizeof(expect_with_sof) && frc >= 0; ++i) {
+            frc = rfc1055_decode_feed(&rfc1055_with_sof, expect_with_sof + i,
+                                      1u, &frame, collect_frame, &r);
+        }
+        ok(frc == 1 && r.frames == 1u && r.status[0] == 0
+           && r.size[0] == sizeof(payload),
+           "RFC1055 feed, octet by octet, yields one frame (%zu)", r.frames);
+        cmp_mem(payload, r.data[0], MIN(sizeof(payload), r.size[0]),
+                "RFC1055 feed, octet by octet, decodes correctly");
+
+        /* Decode in place: The frame buffer is the input memory. */
+        static unsigned char inplace[sizeof(expect_with_sof)];
+        memcpy(inplace, expect_with_sof, sizeof(inplace));
+        ByteBuffer ipframe = BYTE_BUFFER_EMPTY(inplace, sizeof(inplace));
+        memset(&r, 0, sizeof(r));
+        rfc1055_context_init(&rfc1055_with_sof, RFC1055_WITH_SOF);
+        frc = rfc1055_decode_feed(&rfc1055_with_sof, inplace, sizeof(inplace),
+                                  &ipframe, collect_frame, &r);
+        ok(frc == (ssize_t)sizeof(inplace) && r.frames == 1u
+           && r.status[0] == 0 && r.size[0] == sizeof(payload),
+           "RFC1055 feed, in place, yields one frame (%zu)", r.frames);
+        cmp_mem(payload, r.data[0], MIN(sizeof(payload), r.size[0]),
+                "RFC1055 feed, in place, decodes correctly");
+
+        /* Resynchronisation must work like it does with rfc1055_decode() */
+        memset(&r, 0, sizeof(r));
+        rfc1055_context_init(&rfc1055_classic, RFC1055_DEFAULT);
+        for (size_t i = 0u; i < sizeof(sync_to_start); i += 3u) {
+            (void)rfc1055_decode_feed(&rfc1055_classic, sync_to_start + i,
+                                      MIN(3u, sizeof(sync_to_start) - i),
+                                      &frame, collect_frame, &r);
+        }
+        ok(feed_matches(&r, sync_without_sof, swos_n),
+           "RFC1055 feed, sync_to_start, without_sof works");
+
+        memset(&r, 0, sizeof(r));
+        rfc1055_context_init(&rfc1055_with_sof, RFC1055_WITH_SOF);
+        (void)rfc1055_decode_feed(&rfc1055_with_sof, sync_to_start,
+                                  sizeof(sync_to_start),
+                                  &frame, collect_frame, &r);
+        ok(feed_matches(&r, sync_with_sof, sws_n),
+           "RFC1055 feed, sync_to_start, with_sof works");
+
+        /* Broken escape sequence, then a valid frame */
+        static unsigned char broken[] = {
+            'a', 'b', RAW_ESC, 'x', 'c', RAW_EOF, 'd', 'e', RAW_EOF };
+        static char *broken_expect[] = { NULL, "de" };
+        memset(&r, 0, sizeof(r));
+        rfc1055_context_init(&rfc1055_classic, RFC1055_DEFAULT);
+        (void)rfc1055_decode_feed(&rfc1055_classic, broken, sizeof(broken),
+                                  &frame, collect_frame, &r);
+        ok(feed_matches(&r, broken_expect, 2u) && r.status[0] == -EILSEQ,
+           "RFC1055 feed recovers from invalid escape sequence");
+
+        /* Frame too large for the frame buffer, then a valid frame */
+        static unsigned char large[] = {
+            'a', 'b', 'c', 'd', 'e', 'f', RAW_EOF, 'x', 'y', RAW_EOF };
+        static char *large_expect[] = { NULL, "xy" };
+        ByteBuffer small = BYTE_BUFFER_EMPTY(fbuf, 4u);
+        memset(&r, 0, sizeof(r));
+        rfc1055_context_init(&rfc1055_classic, RFC1055_DEFAULT);
+        (void)rfc1055_decode_feed(&rfc1055_classic, large, sizeof(large),
+                                  &small, collect_frame, &r);
+        ok(feed_matches(&r, large_expect, 2u) && r.status[0] == -ENOBUFS,
+           "RFC1055 feed recovers from frame buffer overflow");
+    }
+
+    /*
+     * Batch decoder tests
+     */
+
+    {
+        static unsigned char burst[MEMORY_SIZE];
+        static const unsigned char abc[] = { 'a', 'b', 'c', RAW_EOF, 'd', 'e' };
+        RFC1055Span span[MAX_FRAMES];
+        size_t consumed = 0u;
+        const size_t enclen = sizeof(expect_with_sof) - 1u;
+        memcpy(burst, expect_with_sof + 1, enclen);
+        memcpy(burst + enclen, abc, sizeof(abc));
+        const size_t n = enclen + sizeof(abc);
+
+        rfc1055_context_init(&rfc1055_classic, RFC1055_DEFAULT);
+        ssize_t frc = rfc1055_decode_frames(&rfc1055_classic, burst, n,
+                                            span, MAX_FRAMES, &consumed);
+        ok(frc == 2 && consumed == n - 2u,
+           "RFC1055 batch finds two frames, leaves partial frame (%zd, %zu)",
+           frc, consumed);
+        ok(span[0].offset == 0u && span[0].status == 0
+           && span[0].length == sizeof(payload),
+           "RFC1055 batch describes first frame correctly");
+        cmp_mem(payload, burst, sizeof(payload),
+                "RFC1055 batch decodes first frame in place");
+        ok(span[1].offset == sizeof(payload) && span[1].status == 0
+           && span[1].length == 3u
+           && memcmp(burst + span[1].offset, "abc", 3u) == 0,
+           "RFC1055 batch decodes second frame in place");
+
+        /* A full span array stops the decoder, too. */
+        memcpy(burst, expect_with_sof + 1, enclen);
+        memcpy(burst + enclen, abc, sizeof(abc));
+        rfc1055_context_init(&rfc1055_classic, RFC1055_DEFAULT);
+        frc = rfc1055_decode_frames(&rfc1055_classic, burst, n,
+                                    span, 1u, &consumed);
+        ok(frc == 1 && consumed == enclen,
+           "RFC1055 batch honours span array size (%zd, %zu)", frc, consumed);
+
+        /* Resynchronisation, converted to the feed result format */
+        FeedResult r;
+        memset(&r, 0, sizeof(r));
+        memcpy(burst, sync_to_start, sizeof(sync_to_start));
+        rfc1055_context_init(&rfc1055_with_sof, RFC1055_WITH_SOF);
+        frc = rfc1055_decode_frames(&rfc1055_with_sof, burst,
+                                    sizeof(sync_to_start),
+                                    span, MAX_FRAMES, &consumed);
+        for (ssize_t i = 0; i < frc; ++i) {
+            ByteBuffer f = BYTE_BUFFER(burst + span[i].offset,
+                                       span[i].length);
+            (void)collect_frame(&r, &f, span[i].status);
+        }
+        ok(feed_matches(&r, sync_with_sof, sws_n),
+           "RFC1055 batch, sync_to_start, with_sof works");
+    }
+
     /* Finally check that errors are passed properly */
     instrumentable_until_error_at(&sink_buffer.write.error, 10, -EIO);
 
@@ -186,7 +186,7 @@ main(UNUSED int argc, UNUSED char *argv[])
     }
 #endif /* TEST_DEBUG */
 
-    plan(43);
+    plan(47);
 
     {
         /*
@@ -485,6 +485,33 @@ main(UNUSED int argc, UNUSED char *argv[])
         }
     }
 
+    {
+        /* Incremental payload checksum updates with partial stores */
+        struct info_data infodef = INFO_DATA_DEFAULT;
+        okx(vp_save(&vp, &infodef, sizeof(infodef)) == 0);
+
+        vp.chksum.zeros = ufw_crc16_arc_zeros;
+        infodef.g = 0xdeadbeefUL;
+        const ssize_t storerc = vp_store(&vp, &infodef.g,
+                                         offsetof(struct info_data, g),
+                                         sizeof(infodef.g));
+        const vp_chksum incremental = get_payload_chksum(&vp);
+        ok(storerc == sizeof(infodef.g) && vp_load(&vp) == 0,
+           "Incrementally updated payload checksum verifies");
+
+        vp.chksum.zeros = NULL;
+        (void)vp_store(&vp, &infodef.g, offsetof(struct info_data, g),
+                       sizeof(infodef.g));
+        ok(get_payload_chksum(&vp) == incremental,
+           "Incremental update matches full recalculation");
+        vp.chksum.zeros = ufw_crc16_arc_zeros;
+
+        struct info_data load;
+        (void)vp_fetch(&vp, &load, 0, sizeof(load));
+        cmp_mem(&infodef, &load, sizeof(struct info_data),
+                "Loading data yields same contents");
+    }
+
 #ifdef TEST_DEBUG
     thexdump(storage, STORAGE_SIZE);
 #endif /* TEST_DEBUG */
@@ -0,0 +1,175 @@
+;; Copyright (c) 2026 ufw workers, All rights reserved.
+;;
+;; Terms for redistribution and use can be found in LICENCE.
+
+;; Generate tables for the generic CRC engine in ufw/crc/crc.h.
+;;
+;; The CRC_DEFINE() macro expects two constant tables next to it: NAME_table
+;; with the slice-by-N lookup tables, and NAME_fold with the constants used to
+;; fold large inputs using carry-less multiplication. This program prints both
+;; to stdout. The output belongs into the compilation unit that uses
+;; CRC_DEFINE(). Example use:
+;;
+;;   % ./tools/run tools/make-crc-table.scm ufw_crc32 32 0x04c11db7 reflected 16
+;;
+;; The arguments are: The name of the CRC, its width in bits (8, 16 or 32),
+;; the polynomial (not reflected, without the x^width term), ‘reflected’ or
+;; ‘normal’ for the orientation of the input, and the maximum number of
+;; slices (1, 8 or 16). Tables beyond the first are guarded by UFW_CRC_SLICES,
+;; so builds can opt out of them.
+
+(use-modules (ice-9 format)
+             (ice-9 match)
+             (srfi srfi-1))
+
+(define (usage)
+  (format (current-error-port)
+          "usage: make-crc-table.scm NAME WIDTH POLY reflected|normal SLICES~%")
+  (exit 1))
+
+(define (mask width)
+  (- (ash 1 width) 1))
+
+(define (reflect value width)
+  (let loop ((v value) (n width) (acc 0))
+    (if (zero? n)
+        acc
+        (loop (ash v -1) (1- n) (logior (ash acc 1) (logand v 1))))))
+
+;; CRC of a single octet, with a register value of zero.
+(define (octet-crc width poly reflected? octet)
+  (let ((top (ash 1 (1- width)))
+        (rpoly (reflect poly width)))
+    (let loop ((crc (if reflected? octet (ash octet (- width 8))))
+               (bit 0))
+      (cond ((= bit 8) crc)
+            (reflected?
+             (loop (if (odd? crc)
+                       (logxor (ash crc -1) rpoly)
+                       (ash crc -1))
+                   (1+ bit)))
+            (else
+             (loop (logand (mask width)
+                           (if (zero? (logand crc top))
+                               (ash crc 1)
+                               (logxor (ash crc 1) poly)))
+                   (1+ bit)))))))
+
+;; Table k contains the CRC of octet i, followed by k zero octets.
+(define (next-table first previous width reflected?)
+  (map (lambda (v)
+         (if reflected?
+             (logxor (ash v -8)
+                     (vector-ref first (logand v #xff)))
+             (logxor (logand (mask width) (ash v 8))
+                     (vector-ref first (ash v (- 8 width))))))
+       previous))
+
+(define (make-tables width poly reflected? slices)
+  (let* ((first (map (lambda (i) (octet-crc width poly reflected? i))
+                     (iota 256)))
+         (lookup (list->vector first)))
+    (let loop ((acc (list first)) (k 1))
+      (if (= k slices)
+          (reverse acc)
+          (loop (cons (next-table lookup (car acc) width reflected?) acc)
+                (1+ k))))))
+
+;; x^k mod P, not reflected.
+(define (x-power-mod k width poly)
+  (let ((full (logior (ash 1 width) poly)))
+    (let loop ((r 1) (k k))
+      (if (zero? k)
+          r
+          (let ((r (ash r 1)))
+            (loop (if (logbit? width r) (logxor r full) r)
+                  (1- k)))))))
+
+;; Folding constants are reflected into 64 bits: Bit 63 holds the coefficient
+;; of x^0.
+(define (fold-constant k width poly)
+  (let ((r (x-power-mod k width poly)))
+    (fold (lambda (d acc)
+            (if (logbit? d r)
+                (logior acc (ash 1 (- 63 d)))
+                acc))
+          0
+          (iota width))))
+
+(define (hex value digits)
+  (format #f (string-append "0x~" (number->string digits) ",'0x") value))
+
+(define (split-at* lst n)
+  (if (<= (length lst) n)
+      (list lst)
+      (cons (take lst n) (split-at* (drop lst n) n))))
+
+(define (print-table table k last? width)
+  (let* ((digits (quotient width 4))
+         (per-line (match width (8 12) (16 8) (32 6)))
+         (lines (split-at* table per-line)))
+    (format #t "    { /* ~a */~%" k)
+    (let loop ((rest lines))
+      (unless (null? rest)
+        (format #t "        ~a~a~%"
+                (string-join (map (lambda (v) (hex v digits)) (car rest))
+                             ", ")
+                (if (null? (cdr rest)) "" ","))
+        (loop (cdr rest))))
+    (format #t "    }~a~%" (if last? "" ","))))
+
+(define (print-tables name width poly reflected? slices)
+  (let ((tables (make-tables width poly reflected? slices)))
+    (format #t "static const uint~a_t ~a_table[][256] = {~%" width name)
+    (let loop ((rest tables) (k 0))
+      (unless (null? rest)
+        (when (= k 1)
+          (format #t "#if UFW_CRC_SLICES >= 8~%"))
+        (when (= k 8)
+          (format #t "#if UFW_CRC_SLICES >= 16~%"))
+        (print-table (car rest) k (null? (cdr rest)) width)
+        (loop (cdr rest) (1+ k))))
+    (when (>= slices 16)
+      (format #t "#endif /* UFW_CRC_SLICES >= 16 */~%"))
+    (when (>= slices 8)
+      (format #t "#endif /* UFW_CRC_SLICES >= 8 */~%"))
+    (format #t "};~%")))
+
+(define (print-fold name width poly reflected?)
+  (format #t "~%static const uint64_t ~a_fold[4] = {~%" name)
+  (if reflected?
+      (let loop ((rest '(191 127 575 511)))
+        (unless (null? rest)
+          (format #t "    ~aULL~a /* x^~a mod P */~%"
+                  (hex (fold-constant (car rest) width poly) 16)
+                  (if (null? (cdr rest)) " " ",")
+                  (car rest))
+          (loop (cdr rest))))
+      (format #t "    /* Folding is only supported for reflected CRCs. */
+    0U, 0U, 0U, 0U~%"))
+  (format #t "};~%"))
+
+(match (command-line)
+  ((_ name width poly orientation slices)
+   (let ((width (string->number width))
+         (poly (string->number (if (string-prefix? "0x" poly)
+                                   (substring poly 2)
+                                   poly)
+                               16))
+         (reflected? (string=? orientation "reflected"))
+         (slices (string->number slices)))
+     (unless (and (memv width '(8 16 32))
+                  poly
+                  (member orientation '("reflected" "normal"))
+                  (memv slices '(1 8 16))
+                  (or (= slices 1) (>= (* slices 8) width)))
+       (usage))
+     (format #t "/*
+ * Generated by ‘tools/make-crc-table.scm’ with these arguments:
+ *
+ *   ~a ~a ~a ~a ~a
+ */~%"
+             name width (hex poly (quotient width 4)) orientation slices)
+     (print-tables name width poly reflected? slices)
+     (print-fold name width poly reflected?)))
+  (_ (usage)))
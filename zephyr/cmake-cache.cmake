@@ -37,6 +37,12 @@ if (ZEPHYR_CURRENT_MODULE_NAME AND ("${ZEPHYR_CURRENT_MODULE_NAME}" STREQUAL "uf
       CACHE STRING "Offset for errno-extensions." FORCE)
   endif()
 
+  # UFW_CRC_SLICES
+  if (CONFIG_UFW_CRC_SLICES)
+    set(UFW_CRC_SLICES "${CONFIG_UFW_CRC_SLICES}"
+      CACHE STRING "Slices used by table driven CRCs (1, 8 or 16)" FORCE)
+  endif()
+
   # UFW_ENABLE_COVERAGE
   set(_tmp OFF)
   if (CONFIG_UFW_ENABLE_COVERAGE)